@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 
+#include "activation_scheduler.hpp"
 #include "geo.hpp"
 #include "jsonobj/scenario.hpp"
 #include "logging.hpp"
@@ -52,20 +53,25 @@ private:
      */
     void buildStorage(const jsonobj::Scenario &scenario);
     /**
-     * @brief 指定時刻に合わせて全オブジェクトの位置を更新します。
+     * @brief 指定時刻に合わせて移動中のオブジェクトの位置を更新します。
      *
      * @details ルート補間の手順を1箇所にまとめ、run内の責務を明確化します。
+     *          止まっているオブジェクトは前回の位置のままなので、スケジューラの移動中リストだけを更新します。
      */
     void updatePositions(int time_sec);
+    /**
+     * @brief 1体分の位置を経路に沿って補間します。
+     */
+    void updateObjectPosition(AosObject &obj, int time_sec);
     /**
      * @brief 斥候1体分の探知・失探イベントを生成します。
      *
-     * @details 空間ハッシュの近傍だけを調べ、イベント出力を最小限に抑えます。
+     * @details 空間格子の近傍だけを調べ、イベント出力を最小限に抑えます。
      */
     void updateDetectionForScout(
         int time_sec,
         size_t scout_index,
-        const std::unordered_map<CellKey, std::vector<int>, CellKeyHash> &spatial_hash);
+        const SpatialGrid &spatial_grid);
     /**
      * @brief 攻撃役1体分の爆破イベントを生成します。
      *
@@ -76,6 +82,8 @@ private:
     bool m_initialized = false;
     jsonobj::Scenario m_scenario{};
     AosStorage m_storage{};
+    ActivationScheduler m_scheduler{};
+    SpatialGrid m_spatial_grid{};
     TimelineLogger m_timeline_logger{};
     EventLogger m_event_logger{};
     int m_end_sec = 24 * 60 * 60;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -22,22 +24,41 @@ struct DetectionInfo {
 };
 
 /**
- * @brief 1個体分の情報をまとめたAoS用の構造体です。
+ * @brief 1個体分の情報のうち、毎秒の更新で必ず読む「ホット」な部分をまとめたAoS用の構造体です。
  *
  * @details AoS(Array of Structures)では、1個体の属性を1つの構造体にまとめます。
  *          これにより「個体単位の処理」が読みやすくなり、状態のまとまりを把握しやすくします。
+ *          ただし文字列や可変長配列まで同じ構造体に入れると1要素が数百バイトになり、
+ *          位置更新のたびに使わないデータまでCPUキャッシュへ読み込むことになります。
+ *          そこで毎秒使う属性だけをここに集め、1要素を64バイト(キャッシュライン1本分)に収めます。
+ *          経路は個体ごとの配列ではなくAosStorageの共有プールに置き、ここには「何番目から何個か」だけを持ちます。
  */
 struct AosObject {
-    std::string object_id;
-    std::string team_id;
+    Ecef position{0.0, 0.0, 0.0};
+    double total_duration_sec = 0.0;
     jsonobj::Role role{};
     int start_sec = 0;
+    /**
+     * @brief 所属チームの番号です。探知で味方かどうかを、文字列ではなく整数の比較で判定するために使います。
+     */
+    uint32_t team_index = 0;
+    uint32_t segment_cursor = 0;
+    uint32_t route_offset = 0;
+    uint32_t route_count = 0;
+    uint32_t segment_offset = 0;
+    uint32_t segment_count = 0;
+};
 
-    Ecef position{0.0, 0.0, 0.0};
-    std::vector<RoutePoint> route{};
-    std::vector<double> segment_end_secs{};
-    double total_duration_sec = 0.0;
+static_assert(sizeof(AosObject) <= 64, "AosObject should fit in one cache line");
 
+/**
+ * @brief 1個体分の情報のうち、ログ出力やイベント発生のときだけ読む「コールド」な部分です。
+ *
+ * @details AosObjectと同じ添字で並びます。IDの文字列や探知状態の表はここに置き、位置更新では触れません。
+ */
+struct AosObjectInfo {
+    std::string object_id;
+    std::string team_id;
     std::unordered_map<std::string, DetectionInfo> detect_state{};
     bool has_detonated = false;
 };
@@ -46,7 +67,14 @@ struct AosObject {
  * @brief AoS形式の配列をまとめたストレージです。
  *
  * @details 1個体ごとの構造体を配列で持ち、個体単位の更新処理をわかりやすくします。
+ *          objects(ホット)とinfos(コールド)は同じ添字で同じ個体を表します。
+ *          経路点・区間終了時刻・区間移動レコードは全個体分を1本ずつの配列(共有プール)にまとめ、
+ *          各個体はAosObjectのoffset/countでその一部を参照します。
  */
 struct AosStorage {
     std::vector<AosObject> objects{};
+    std::vector<AosObjectInfo> infos{};
+    std::vector<RoutePoint> route_points{};
+    std::vector<double> segment_end_secs{};
+    std::vector<SegmentMotion> segment_motions{};
 };
@@ -0,0 +1,39 @@
+#include "activation_scheduler.hpp"
+
+void ActivationScheduler::clear() {
+    m_pending.clear();
+    m_next_pending = 0;
+    m_active.clear();
+}
+
+void ActivationScheduler::add(size_t index, int start_sec) {
+    m_pending.push_back(PendingEntry{start_sec, index});
+}
+
+void ActivationScheduler::rewind() {
+    // 開始時刻の早い順に並べておけば、毎秒は待機列の先頭だけを見れば済みます。
+    std::sort(m_pending.begin(), m_pending.end(), [](const PendingEntry &a, const PendingEntry &b) {
+        if (a.start_sec != b.start_sec) {
+            return a.start_sec < b.start_sec;
+        }
+        return a.index < b.index;
+    });
+    m_next_pending = 0;
+    m_active.clear();
+    m_active.reserve(m_pending.size());
+}
+
+void ActivationScheduler::activate(int time_sec) {
+    // 開始時刻を迎えたものを末尾に追加し、添字の昇順になるように既存の一覧とマージします。
+    size_t previous_size = m_active.size();
+    while (m_next_pending < m_pending.size() && m_pending[m_next_pending].start_sec <= time_sec) {
+        m_active.push_back(m_pending[m_next_pending].index);
+        ++m_next_pending;
+    }
+    if (m_active.size() == previous_size) {
+        return;
+    }
+    auto middle = m_active.begin() + static_cast<std::ptrdiff_t>(previous_size);
+    std::sort(middle, m_active.end());
+    std::inplace_merge(m_active.begin(), middle, m_active.end());
+}
@@ -47,32 +47,62 @@ void AosSimulation::buildStorage(const jsonobj::Scenario &scenario) {
     }
 
     m_storage.objects.clear();
+    m_storage.infos.clear();
+    m_storage.route_points.clear();
+    m_storage.segment_end_secs.clear();
+    m_storage.segment_motions.clear();
     m_storage.objects.reserve(total_objects);
+    m_storage.infos.reserve(total_objects);
+
+    // チームIDの文字列を、出てきた順に0, 1, 2...の番号へ置き換えます。
+    std::vector<std::string> team_ids;
 
     for (const auto &team : scenario.getTeams()) {
+        auto team_it = std::find(team_ids.begin(), team_ids.end(), team.getId());
+        uint32_t team_index = static_cast<uint32_t>(team_it - team_ids.begin());
+        if (team_it == team_ids.end()) {
+            team_ids.push_back(team.getId());
+        }
         for (const auto &obj : team.getObjects()) {
             std::vector<RoutePoint> route = buildRoute(obj.getRoute());
             auto segment_info = buildSegmentTimes(route);
             std::vector<double> segment_ends = std::move(segment_info.first);
             double total_duration = segment_info.second;
+            std::vector<SegmentMotion> motions = buildSegmentMotions(route, segment_ends);
 
+            // 毎秒使う属性はホットな構造体へ、IDや探知状態はコールドな構造体へ分けて入れます。
             AosObject record;
-            record.object_id = obj.getId();
-            record.team_id = team.getId();
             record.role = obj.getRole();
             record.start_sec = static_cast<int>(obj.getStartSec());
-            record.route = std::move(route);
-            record.segment_end_secs = std::move(segment_ends);
+            record.team_index = team_index;
             record.total_duration_sec = total_duration;
-            record.has_detonated = false;
-
-            if (!record.route.empty()) {
-                record.position = record.route.front().ecef;
-            } else {
-                record.position = Ecef{0.0, 0.0, 0.0};
-            }
-
-            m_storage.objects.push_back(std::move(record));
+            record.position = route.empty() ? Ecef{0.0, 0.0, 0.0} : route.front().ecef;
+
+            // 経路は共有プールの末尾に追加し、個体には「何番目から何個か」だけを覚えさせます。
+            record.route_offset = static_cast<uint32_t>(m_storage.route_points.size());
+            record.route_count = static_cast<uint32_t>(route.size());
+            m_storage.route_points.insert(m_storage.route_points.end(), route.begin(), route.end());
+            record.segment_offset = static_cast<uint32_t>(m_storage.segment_end_secs.size());
+            record.segment_count = static_cast<uint32_t>(segment_ends.size());
+            m_storage.segment_end_secs.insert(m_storage.segment_end_secs.end(), segment_ends.begin(), segment_ends.end());
+            m_storage.segment_motions.insert(m_storage.segment_motions.end(), motions.begin(), motions.end());
+
+            AosObjectInfo info;
+            info.object_id = obj.getId();
+            info.team_id = team.getId();
+            info.has_detonated = false;
+
+            m_storage.objects.push_back(record);
+            m_storage.infos.push_back(std::move(info));
+        }
+    }
+    // 移動する可能性があるのは、経路を持つ司令官以外のオブジェクトだけです。
+    // 司令官や経路なしのオブジェクトは初期位置のまま動かないので、スケジューラに登録しません。
+    m_scheduler.clear();
+    for (size_t i = 0; i < m_storage.objects.size(); ++i) {
+        const AosObject &obj = m_storage.objects[i];
+        if (obj.role != jsonobj::Role::COMMANDER && obj.route_count != 0) {
+            m_scheduler.add(i, obj.start_sec);
         }
     }
 }
@@ -100,15 +130,16 @@ void AosSimulation::run() {
     }
 
     // AoSでは「1個体のまとまり」を順番に更新し、イベント判定とログ出力を行います。
+    m_scheduler.rewind();
     for (int time_sec = 0; time_sec <= m_end_sec; ++time_sec) {
         updatePositions(time_sec);
 
-        std::unordered_map<CellKey, std::vector<int>, CellKeyHash> spatial_hash =
-            buildSpatialHash(m_storage, static_cast<double>(m_detect_range_m));
+        // 空間格子は毎秒作り直しますが、配列は使い回すので2秒目以降はヒープ確保が起きません。
+        m_spatial_grid.build(m_storage, static_cast<double>(m_detect_range_m));
 
         for (size_t i = 0; i < m_storage.objects.size(); ++i) {
             if (m_storage.objects[i].role == jsonobj::Role::SCOUT) {
-                updateDetectionForScout(time_sec, i, spatial_hash);
+                updateDetectionForScout(time_sec, i, m_spatial_grid);
             }
         }
 
@@ -123,76 +154,78 @@ void AosSimulation::run() {
 }
 
 void AosSimulation::updatePositions(int time_sec) {
-    // AoSでは個体単位で状態を更新するため、1件ずつ読みやすく処理できます。
-    for (auto &obj : m_storage.objects) {
-        if (obj.route.empty()) {
-            obj.position = Ecef{0.0, 0.0, 0.0};
-            continue;
-        }
+    // 開始時刻を迎えたオブジェクトを移動中リストに加え、移動中のものだけを1件ずつ更新します。
+    // 司令官・開始前・移動完了後のオブジェクトは位置が変わらないので、前回の位置をそのまま使います。
+    m_scheduler.activate(time_sec);
+    for (size_t index : m_scheduler.active()) {
+        updateObjectPosition(m_storage.objects[index], time_sec);
+    }
 
-        const RoutePoint &first = obj.route.front();
+    // 最後の経路点に着いたオブジェクトは、以降ずっと同じ位置なので移動中リストから外します。
+    m_scheduler.retireIf([&](size_t index) {
+        const AosObject &obj = m_storage.objects[index];
+        double elapsed = static_cast<double>(time_sec - obj.start_sec);
+        return obj.segment_count == 0 || elapsed >= obj.total_duration_sec;
+    });
+}
 
-        if (obj.role == jsonobj::Role::COMMANDER) {
-            obj.position = first.ecef;
-            continue;
-        }
+void AosSimulation::updateObjectPosition(AosObject &obj, int time_sec) {
+    // AoSでは個体単位で状態を更新するため、1件ずつ読みやすく処理できます。
+    // 経路点や区間のデータは共有プールにあり、個体が持つoffset/countでその範囲を参照します。
+    if (obj.route_count == 0) {
+        obj.position = Ecef{0.0, 0.0, 0.0};
+        return;
+    }
 
-        if (time_sec < obj.start_sec) {
-            obj.position = first.ecef;
-            continue;
-        }
+    const RoutePoint &first = m_storage.route_points[obj.route_offset];
+    const RoutePoint &last = m_storage.route_points[obj.route_offset + obj.route_count - 1];
 
-        if (obj.segment_end_secs.empty()) {
-            obj.position = obj.route.back().ecef;
-            continue;
-        }
+    if (obj.role == jsonobj::Role::COMMANDER) {
+        obj.position = first.ecef;
+        return;
+    }
 
-        double elapsed = static_cast<double>(time_sec - obj.start_sec);
-        if (elapsed >= obj.total_duration_sec) {
-            obj.position = obj.route.back().ecef;
-            continue;
-        }
+    if (time_sec < obj.start_sec) {
+        obj.position = first.ecef;
+        return;
+    }
 
-        auto it = std::upper_bound(obj.segment_end_secs.begin(), obj.segment_end_secs.end(), elapsed);
-        size_t segment_index = static_cast<size_t>(std::distance(obj.segment_end_secs.begin(), it));
-        if (segment_index >= obj.segment_end_secs.size()) {
-            obj.position = obj.route.back().ecef;
-            continue;
-        }
+    if (obj.segment_count == 0) {
+        obj.position = last.ecef;
+        return;
+    }
 
-        double segment_end = obj.segment_end_secs[segment_index];
-        double segment_start = (segment_index == 0) ? 0.0 : obj.segment_end_secs[segment_index - 1];
-        double segment_duration = segment_end - segment_start;
-        if (segment_duration <= 0.0) {
-            obj.position = obj.route[segment_index + 1].ecef;
-            continue;
-        }
-        if (!std::isfinite(segment_duration)) {
-            obj.position = obj.route[segment_index].ecef;
-            continue;
-        }
+    double elapsed = static_cast<double>(time_sec - obj.start_sec);
+    if (elapsed >= obj.total_duration_sec) {
+        obj.position = last.ecef;
+        return;
+    }
 
-        double t = (elapsed - segment_start) / segment_duration;
-        const RoutePoint &a = obj.route[segment_index];
-        const RoutePoint &b = obj.route[segment_index + 1];
-        obj.position = Ecef{
-            a.ecef.x + (b.ecef.x - a.ecef.x) * t,
-            a.ecef.y + (b.ecef.y - a.ecef.y) * t,
-            a.ecef.z + (b.ecef.z - a.ecef.z) * t,
-        };
+    // 前回の区間番号から前へ進めるだけで済むため、毎秒の二分探索を省けます。
+    obj.segment_cursor = static_cast<uint32_t>(advanceSegmentCursor(
+        m_storage.segment_end_secs.data() + obj.segment_offset, obj.segment_count, obj.segment_cursor, elapsed));
+    size_t segment_index = obj.segment_cursor;
+    if (segment_index >= obj.segment_count) {
+        obj.position = last.ecef;
+        return;
     }
+
+    // 区間の始点と速度ベクトルは前計算済みなので、掛け算と足し算だけで位置が求まります。
+    // 速度0の区間や長さ0の区間も、速度0のレコードとして同じ式で扱えます。
+    obj.position = segmentPosition(m_storage.segment_motions[obj.segment_offset + segment_index], elapsed);
 }
 
 void AosSimulation::updateDetectionForScout(
     int time_sec,
     size_t scout_index,
-    const std::unordered_map<CellKey, std::vector<int>, CellKeyHash> &spatial_hash) {
+    const SpatialGrid &spatial_grid) {
     // 探知範囲が無効なら処理を省略し、無駄な計算を避けます。
     if (m_detect_range_m <= 0) {
         return;
     }
 
-    AosObject &scout = m_storage.objects[scout_index];
+    const AosObject &scout = m_storage.objects[scout_index];
+    AosObjectInfo &scout_info = m_storage.infos[scout_index];
     std::unordered_map<std::string, DetectionInfo> current_detected;
     CellKey base = cellKey(scout.position, static_cast<double>(m_detect_range_m));
 
@@ -200,17 +233,13 @@ void AosSimulation::updateDetectionForScout(
         for (int dy = -1; dy <= 1; ++dy) {
             for (int dz = -1; dz <= 1; ++dz) {
                 CellKey key{base.x + dx, base.y + dy, base.z + dz};
-                auto it = spatial_hash.find(key);
-                if (it == spatial_hash.end()) {
-                    continue;
-                }
-                for (int index : it->second) {
+                for (int index : spatial_grid.cell(key)) {
                     size_t other_index = static_cast<size_t>(index);
                     if (other_index == scout_index) {
                         continue;
                     }
                     const AosObject &other = m_storage.objects[other_index];
-                    if (other.team_id == scout.team_id) {
+                    if (other.team_index == scout.team_index) {
                         continue;
                     }
                     double distance = distanceEcef(scout.position, other.position);
@@ -226,14 +255,14 @@ void AosSimulation::updateDetectionForScout(
                     info.lon_deg = lon;
                     info.alt_m = alt;
                     info.distance_m = static_cast<int>(std::llround(distance));
-                    current_detected.emplace(other.object_id, info);
+                    current_detected.emplace(m_storage.infos[other_index].object_id, info);
                 }
             }
         }
     }
 
     for (const auto &entry : current_detected) {
-        if (scout.detect_state.find(entry.first) != scout.detect_state.end()) {
+        if (scout_info.detect_state.find(entry.first) != scout_info.detect_state.end()) {
             continue;
         }
         const DetectionInfo &info = entry.second;
@@ -241,7 +270,7 @@ void AosSimulation::updateDetectionForScout(
         event.setEventType("detection");
         event.setDetectionAction(jsonobj::DetectionAction::FOUND);
         event.setTimeSec(time_sec);
-        event.setScountId(scout.object_id);
+        event.setScountId(scout_info.object_id);
         event.setLatDeg(info.lat_deg);
         event.setLonDeg(info.lon_deg);
         event.setAltM(info.alt_m);
@@ -252,7 +281,7 @@ void AosSimulation::updateDetectionForScout(
         m_event_logger.write(json_event);
     }
 
-    for (const auto &entry : scout.detect_state) {
+    for (const auto &entry : scout_info.detect_state) {
         if (current_detected.find(entry.first) != current_detected.end()) {
             continue;
         }
@@ -261,7 +290,7 @@ void AosSimulation::updateDetectionForScout(
         event.setEventType("detection");
         event.setDetectionAction(jsonobj::DetectionAction::LOST);
         event.setTimeSec(time_sec);
-        event.setScountId(scout.object_id);
+        event.setScountId(scout_info.object_id);
         event.setLatDeg(info.lat_deg);
         event.setLonDeg(info.lon_deg);
         event.setAltM(info.alt_m);
@@ -272,13 +301,14 @@ void AosSimulation::updateDetectionForScout(
         m_event_logger.write(json_event);
     }
 
-    scout.detect_state = std::move(current_detected);
+    scout_info.detect_state = std::move(current_detected);
 }
 
 void AosSimulation::emitDetonationForAttacker(int time_sec, size_t attacker_index) {
     // 爆破イベントは攻撃役の責務として扱い、1回だけ発火させます。
-    AosObject &attacker = m_storage.objects[attacker_index];
-    if (attacker.has_detonated) {
+    const AosObject &attacker = m_storage.objects[attacker_index];
+    AosObjectInfo &attacker_info = m_storage.infos[attacker_index];
+    if (attacker_info.has_detonated) {
         return;
     }
     if (!std::isfinite(attacker.total_duration_sec)) {
@@ -296,7 +326,7 @@ void AosSimulation::emitDetonationForAttacker(int time_sec, size_t attacker_inde
     jsonobj::DetonationEvent event;
     event.setEventType("detonation");
     event.setTimeSec(time_sec);
-    event.setAttackerId(attacker.object_id);
+    event.setAttackerId(attacker_info.object_id);
     event.setLatDeg(lat);
     event.setLonDeg(lon);
     event.setAltM(alt);
@@ -304,5 +334,5 @@ void AosSimulation::emitDetonationForAttacker(int time_sec, size_t attacker_inde
     nlohmann::json json_event;
     jsonobj::to_json(json_event, event);
     m_event_logger.write(json_event);
-    attacker.has_detonated = true;
+    attacker_info.has_detonated = true;
 }
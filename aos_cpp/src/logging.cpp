@@ -32,14 +32,16 @@ void TimelineLogger::write(int time_sec, const AosStorage &storage, const AosSim
     std::vector<jsonobj::TimelinePosition> positions;
     positions.reserve(storage.objects.size());
 
-    for (const auto &obj : storage.objects) {
+    for (size_t i = 0; i < storage.objects.size(); ++i) {
+        const AosObject &obj = storage.objects[i];
+        const AosObjectInfo &info = storage.infos[i];
         jsonobj::TimelinePosition position;
         double lat = 0.0;
         double lon = 0.0;
         double alt = 0.0;
         ecefToGeodetic(obj.position, lat, lon, alt);
-        position.setObjectId(obj.object_id);
-        position.setTeamId(obj.team_id);
+        position.setObjectId(info.object_id);
+        position.setTeamId(info.team_id);
         position.setRole(simulation.roleToString(obj.role));
         position.setLatDeg(lat);
         position.setLonDeg(lon);
@@ -1,14 +1,16 @@
 #include "spatial_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 size_t CellKeyHash::operator()(const CellKey &key) const {
-    // 3軸を混ぜ合わせることで、セル座標の分布が偏っても衝突を減らします。
-    // 空間ハッシュの詳細はここに閉じ込め、他の箇所からは使いやすい関数だけを見せます。
-    size_t h1 = std::hash<int>{}(key.x);
-    size_t h2 = std::hash<int>{}(key.y);
-    size_t h3 = std::hash<int>{}(key.z);
-    return (h1 * 73856093u) ^ (h2 * 19349663u) ^ (h3 * 83492791u);
+    // 3軸を順に掛け算で混ぜ合わせ、最後に上位ビットを下位へ折り返します。
+    // 単純なXORでは近いセル同士の値が似てしまい、ハッシュ表の同じ位置に集まりやすくなるためです。
+    uint64_t h = static_cast<uint32_t>(key.x);
+    h = h * 0x9E3779B97F4A7C15ull ^ static_cast<uint32_t>(key.y);
+    h = h * 0x9E3779B97F4A7C15ull ^ static_cast<uint32_t>(key.z);
+    h *= 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(h ^ (h >> 32));
 }
 
 CellKey cellKey(const Ecef &pos, double cell_size) {
@@ -19,18 +21,78 @@ CellKey cellKey(const Ecef &pos, double cell_size) {
     };
 }
 
-std::unordered_map<CellKey, std::vector<int>, CellKeyHash> buildSpatialHash(
-    const AosStorage &storage,
-    double cell_size) {
-    std::unordered_map<CellKey, std::vector<int>, CellKeyHash> result;
+void SpatialGrid::build(const AosStorage &storage, double cell_size) {
+    size_t count = storage.objects.size();
+    m_cell_count = 0;
     if (cell_size <= 0.0) {
-        return result;
+        m_cell_starts.assign(1, 0);
+        m_items.clear();
+        return;
     }
-    // 各オブジェクトをセルに割り当て、近傍探索の候補集合を高速に作ります。
-    // 探知は斥候の責務ですが、空間分割はここで共通処理として提供します。
-    for (size_t i = 0; i < storage.objects.size(); ++i) {
+
+    // ハッシュ表の枠数はオブジェクト数の2倍以上の2のべき乗にし、探索が短く済むようにします。
+    // 足りないときだけ広げるので、オブジェクト数が変わらなければ確保は最初の1回だけです。
+    size_t slot_count = 16;
+    while (slot_count < count * 2) {
+        slot_count *= 2;
+    }
+    if (m_slots.size() < slot_count) {
+        m_slots.assign(slot_count, Slot{});
+        m_slot_mask = slot_count - 1;
+        m_stamp = 0;
+    }
+    // 番号が一周したときだけ表全体を消し、古い枠を使用中と見間違えないようにします。
+    if (++m_stamp == 0) {
+        std::fill(m_slots.begin(), m_slots.end(), Slot{});
+        m_stamp = 1;
+    }
+
+    // 1回目の走査: セル番号を振りながら、セルごとの数をm_cell_starts[セル番号 + 1]に数えます。
+    m_object_cells.resize(count);
+    m_cell_starts.assign(count + 1, 0);
+    for (size_t i = 0; i < count; ++i) {
         CellKey key = cellKey(storage.objects[i].position, cell_size);
-        result[key].push_back(static_cast<int>(i));
+        Slot &slot = m_slots[findSlot(key)];
+        if (slot.stamp != m_stamp) {
+            slot.key = key;
+            slot.cell = static_cast<uint32_t>(m_cell_count++);
+            slot.stamp = m_stamp;
+        }
+        m_object_cells[i] = slot.cell;
+        ++m_cell_starts[slot.cell + 1];
+    }
+
+    // 累積和を取ると、m_cell_starts[c]がセルcの先頭位置になります。
+    for (size_t c = 0; c < m_cell_count; ++c) {
+        m_cell_starts[c + 1] += m_cell_starts[c];
+    }
+
+    // 2回目の走査: 番号の昇順に各セルの書き込み位置へ置いていきます。
+    m_cell_cursors.assign(m_cell_starts.begin(), m_cell_starts.begin() + static_cast<std::ptrdiff_t>(m_cell_count));
+    m_items.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        m_items[m_cell_cursors[m_object_cells[i]]++] = static_cast<int>(i);
+    }
+}
+
+SpatialGrid::CellRange SpatialGrid::cell(const CellKey &key) const {
+    if (m_cell_count == 0) {
+        return CellRange{};
+    }
+    const Slot &slot = m_slots[findSlot(key)];
+    if (slot.stamp != m_stamp) {
+        return CellRange{};
+    }
+    const int *items = m_items.data();
+    return CellRange{items + m_cell_starts[slot.cell], items + m_cell_starts[slot.cell + 1]};
+}
+
+size_t SpatialGrid::findSlot(const CellKey &key) const {
+    // 枠が埋まっていて別のキーなら、隣の枠へ進みます(線形探索法)。
+    // 枠数はオブジェクト数の2倍以上あるため、必ず空き枠か同じキーの枠に行き着きます。
+    size_t pos = CellKeyHash{}(key) & m_slot_mask;
+    while (m_slots[pos].stamp == m_stamp && !(m_slots[pos].key == key)) {
+        pos = (pos + 1) & m_slot_mask;
     }
-    return result;
+    return pos;
 }
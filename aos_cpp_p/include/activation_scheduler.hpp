@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief 移動中のオブジェクトだけを一覧として管理するスケジューラです。
+ *
+ * @details 司令官は移動せず、開始時刻前は最初の経路点、移動完了後は最後の経路点に留まります。
+ *          そのようなオブジェクトは位置が変わらないため、毎秒の位置更新から外せます。
+ *          開始時刻順に並べた待機列から、時刻が来たものを「移動中リスト」へ移し、
+ *          移動を終えたものはリストから外すことで、更新ループを移動中の数だけに抑えます。
+ *          時刻は前にしか進まない前提なので、時刻を戻すときはrewindで最初からやり直します。
+ */
+class ActivationScheduler {
+public:
+    /**
+     * @brief 登録内容をすべて消去します。
+     */
+    void clear();
+    /**
+     * @brief 移動する可能性のあるオブジェクトを開始時刻とともに登録します。
+     */
+    void add(size_t index, int start_sec);
+    /**
+     * @brief 時刻0の状態に戻します。待機列を開始時刻順に並べ直し、移動中リストを空にします。
+     */
+    void rewind();
+    /**
+     * @brief 開始時刻がtime_sec以下になったオブジェクトを移動中リストへ移します。
+     *
+     * @details 移動中リストは添字の昇順を保つため、配列を前から順に読むアクセスになります。
+     */
+    void activate(int time_sec);
+    /**
+     * @brief 現在移動中のオブジェクトの添字一覧を返します。
+     */
+    const std::vector<size_t> &active() const { return m_active; }
+    /**
+     * @brief 条件を満たした(移動を終えた)オブジェクトを移動中リストから外します。
+     *
+     * @details 残ったオブジェクトの並び順は変えません。
+     */
+    template <typename Predicate>
+    void retireIf(Predicate predicate) {
+        m_active.erase(std::remove_if(m_active.begin(), m_active.end(), predicate), m_active.end());
+    }
+
+private:
+    /**
+     * @brief 待機列の1件分です。開始時刻と添字を持ちます。
+     */
+    struct PendingEntry {
+        int start_sec;
+        size_t index;
+    };
+
+    std::vector<PendingEntry> m_pending{};
+    size_t m_next_pending = 0;
+    std::vector<size_t> m_active{};
+};
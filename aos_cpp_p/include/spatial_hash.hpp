@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geo.hpp"
+#include "aos_storage.hpp"
+
+/**
+ * @brief 空間ハッシュ用のセル座標を表す構造体です。
+ *
+ * @details 探知範囲ごとに空間を立方体セルに区切り、同じセル内の候補だけを探すために使います。
+ */
+struct CellKey {
+    int x;
+    int y;
+    int z;
+};
+
+/**
+ * @brief CellKey同士の等価判定を定義します。
+ *
+ * @details ハッシュ表でキー比較が必要になるため、3軸が同じかを明示的に比較します。
+ */
+inline bool operator==(const CellKey &a, const CellKey &b) {
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+/**
+ * @brief CellKeyのハッシュ値を計算する関数オブジェクトです。
+ *
+ * @details 空間格子のハッシュ表は下位ビットで位置を決めるため、3軸の値を掛け算で全ビットに混ぜてから返します。
+ */
+struct CellKeyHash {
+    size_t operator()(const CellKey &key) const;
+};
+
+/**
+ * @brief 位置とセルサイズからセル座標を計算します。
+ */
+CellKey cellKey(const Ecef &pos, double cell_size);
+
+/**
+ * @brief 空間を立方体セルに区切り、セルごとのオブジェクト番号を1本の配列にまとめた空間格子です。
+ *
+ * @details セルごとにvectorを持つハッシュ表は、毎秒セルの数だけヒープ確保が起きます。
+ *          この格子は次の数回の線形な走査だけで作り直します(CSR形式: 圧縮行格納)。
+ *          1. 各オブジェクトのセル座標を求め、ハッシュ表でセル番号を振りながらセルごとの数を数えます。
+ *          2. 数の累積和から、各セルの先頭位置(m_cell_starts)を求めます。
+ *          3. オブジェクト番号を先頭位置へ順に書き込みます(計数ソート)。
+ *          書き込みは番号の昇順なので、セル内の並びはハッシュ表に追加していたときと同じです。
+ *          配列とハッシュ表は使い回し、オブジェクト数が増えない限り作り直しでヒープ確保は起きません。
+ */
+class SpatialGrid {
+public:
+    /**
+     * @brief 1セル分のオブジェクト番号の範囲です。範囲for文でそのまま回せます。
+     */
+    struct CellRange {
+        const int *first = nullptr;
+        const int *last = nullptr;
+        const int *begin() const { return first; }
+        const int *end() const { return last; }
+    };
+
+    /**
+     * @brief AoSの位置情報から格子を作り直します。
+     *
+     * @details 探知処理の前に候補を絞り込むための前処理です。cell_sizeが0以下のときは空の格子になります。
+     */
+    void build(const AosStorage &storage, double cell_size);
+    /**
+     * @brief 指定したセルにいるオブジェクト番号の範囲を返します。誰もいないセルは空の範囲です。
+     */
+    CellRange cell(const CellKey &key) const;
+
+private:
+    /**
+     * @brief ハッシュ表の1枠です。stampが今回の作り直しの番号と同じ枠だけが使用中です。
+     *
+     * @details 番号で使用中かどうかを見分けるため、作り直しのたびに表全体を消す必要がありません。
+     */
+    struct Slot {
+        CellKey key{0, 0, 0};
+        uint32_t cell = 0;
+        uint32_t stamp = 0;
+    };
+
+    /**
+     * @brief keyが入っている枠、なければ次に使う空き枠の位置を線形探索で探します。
+     */
+    size_t findSlot(const CellKey &key) const;
+
+    std::vector<Slot> m_slots{};
+    std::vector<uint32_t> m_object_cells{};
+    std::vector<uint32_t> m_cell_starts{};
+    std::vector<uint32_t> m_cell_cursors{};
+    std::vector<int> m_items{};
+    size_t m_slot_mask = 0;
+    size_t m_cell_count = 0;
+    uint32_t m_stamp = 0;
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief 連続した添字の範囲をチャンク(一定数ずつのかたまり)に分け、複数スレッドで処理するスレッドプールです。
+ *
+ * @details スレッドは最初に1回だけ作り、毎秒の処理ではチャンクの受け渡しだけを行います。
+ *          スレッドを毎回作り直す負担を避けるためです。
+ *          呼び出し元のスレッドも作業に加わるため、作業用スレッドは「並列数 - 1」本だけ用意します。
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief 指定した並列数(呼び出し元スレッドを含む)でスレッドプールを作ります。0は1として扱います。
+     */
+    explicit ThreadPool(size_t thread_count);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief 呼び出し元スレッドを含めた並列数を返します。
+     */
+    size_t threadCount() const { return m_workers.size() + 1; }
+
+    /**
+     * @brief [0, count)をchunk_size件ずつに分け、各チャンクについてtask(begin, end)を呼び出します。
+     *
+     * @details すべてのチャンクが終わるまで戻りません。チャンクを処理するスレッドや順番は決まっていないため、
+     *          taskは自分のチャンクの添字だけを書き換えるようにしてください。
+     *          taskが例外を投げた場合は、すべてのチャンクが終わった後に最初の例外を呼び出し元へ投げ直します。
+     */
+    void parallelFor(size_t count, size_t chunk_size, const std::function<void(size_t, size_t)> &task);
+
+private:
+    /**
+     * @brief 作業用スレッドの本体です。仕事の合図を待ち、チャンクがなくなるまで処理します。
+     */
+    void workerLoop();
+    /**
+     * @brief 残っているチャンクを1つずつ取り出して処理します。呼び出し元と作業用スレッドが共用します。
+     */
+    void runChunks();
+
+    std::vector<std::thread> m_workers{};
+    std::mutex m_mutex{};
+    std::condition_variable m_start_cv{};
+    std::condition_variable m_done_cv{};
+    const std::function<void(size_t, size_t)> *m_task = nullptr;
+    size_t m_count = 0;
+    size_t m_chunk_size = 1;
+    std::atomic<size_t> m_next_begin{0};
+    size_t m_generation = 0;
+    size_t m_running_workers = 0;
+    std::exception_ptr m_error{};
+    bool m_stopping = false;
+};
+
+/**
+ * @brief 環境変数CHUNK_SIZEからチャンクサイズを読み取ります。未指定や不正な値のときは256です。
+ */
+size_t resolveChunkSize();
+
+/**
+ * @brief 環境変数PARALLELISMから並列数を読み取ります。未指定や不正な値のときはCPUのスレッド数です。
+ */
+size_t resolveParallelism();
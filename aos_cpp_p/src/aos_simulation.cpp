@@ -0,0 +1,365 @@
+#include "aos_simulation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "jsonobj/detection_event.hpp"
+#include "jsonobj/detonation_event.hpp"
+#include "route.hpp"
+#include "spatial_hash.hpp"
+
+std::string AosSimulation::roleToString(jsonobj::Role role) const {
+    // 役割の文字列化を一箇所にまとめて、ログ出力の表記を統一します。
+    switch (role) {
+    case jsonobj::Role::COMMANDER:
+        return "commander";
+    case jsonobj::Role::SCOUT:
+        return "scout";
+    case jsonobj::Role::MESSENGER:
+        return "messenger";
+    case jsonobj::Role::ATTACKER:
+        return "attacker";
+    }
+    return "unknown";
+}
+
+jsonobj::Scenario AosSimulation::loadScenario(const std::string &path) const {
+    // シナリオ読み込みはSimulation内部で完結させ、外部に解析手順を露出しません。
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("scenario: failed to open " + path);
+    }
+    nlohmann::json data;
+    file >> data;
+    jsonobj::Scenario scenario;
+    jsonobj::from_json(data, scenario);
+    return scenario;
+}
+
+void AosSimulation::buildStorage(const jsonobj::Scenario &scenario) {
+    // シナリオの定義をAoS配列へ展開し、1個体分の情報がまとまるようにします。
+    size_t total_objects = 0;
+    for (const auto &team : scenario.getTeams()) {
+        total_objects += team.getObjects().size();
+    }
+
+    m_storage.objects.clear();
+    m_storage.infos.clear();
+    m_storage.route_points.clear();
+    m_storage.segment_end_secs.clear();
+    m_storage.segment_motions.clear();
+    m_storage.objects.reserve(total_objects);
+    m_storage.infos.reserve(total_objects);
+
+    // チームIDの文字列を、出てきた順に0, 1, 2...の番号へ置き換えます。
+    std::vector<std::string> team_ids;
+
+    for (const auto &team : scenario.getTeams()) {
+        auto team_it = std::find(team_ids.begin(), team_ids.end(), team.getId());
+        uint32_t team_index = static_cast<uint32_t>(team_it - team_ids.begin());
+        if (team_it == team_ids.end()) {
+            team_ids.push_back(team.getId());
+        }
+        for (const auto &obj : team.getObjects()) {
+            std::vector<RoutePoint> route = buildRoute(obj.getRoute());
+            auto segment_info = buildSegmentTimes(route);
+            std::vector<double> segment_ends = std::move(segment_info.first);
+            double total_duration = segment_info.second;
+            std::vector<SegmentMotion> motions = buildSegmentMotions(route, segment_ends);
+
+            // 毎秒使う属性はホットな構造体へ、IDや探知状態はコールドな構造体へ分けて入れます。
+            AosObject record;
+            record.role = obj.getRole();
+            record.start_sec = static_cast<int>(obj.getStartSec());
+            record.team_index = team_index;
+            record.total_duration_sec = total_duration;
+            record.position = route.empty() ? Ecef{0.0, 0.0, 0.0} : route.front().ecef;
+
+            // 経路は共有プールの末尾に追加し、個体には「何番目から何個か」だけを覚えさせます。
+            record.route_offset = static_cast<uint32_t>(m_storage.route_points.size());
+            record.route_count = static_cast<uint32_t>(route.size());
+            m_storage.route_points.insert(m_storage.route_points.end(), route.begin(), route.end());
+            record.segment_offset = static_cast<uint32_t>(m_storage.segment_end_secs.size());
+            record.segment_count = static_cast<uint32_t>(segment_ends.size());
+            m_storage.segment_end_secs.insert(m_storage.segment_end_secs.end(), segment_ends.begin(), segment_ends.end());
+            m_storage.segment_motions.insert(m_storage.segment_motions.end(), motions.begin(), motions.end());
+
+            AosObjectInfo info;
+            info.object_id = obj.getId();
+            info.team_id = team.getId();
+            info.has_detonated = false;
+
+            m_storage.objects.push_back(record);
+            m_storage.infos.push_back(std::move(info));
+        }
+    }
+    m_pending_events.assign(m_storage.objects.size(), {});
+    // 移動する可能性があるのは、経路を持つ司令官以外のオブジェクトだけです。
+    // 司令官や経路なしのオブジェクトは初期位置のまま動かないので、スケジューラに登録しません。
+    m_scheduler.clear();
+    for (size_t i = 0; i < m_storage.objects.size(); ++i) {
+        const AosObject &obj = m_storage.objects[i];
+        if (obj.role != jsonobj::Role::COMMANDER && obj.route_count != 0) {
+            m_scheduler.add(i, obj.start_sec);
+        }
+    }
+}
+
+void AosSimulation::initialize(const std::string &scenario_path,
+                               const std::string &timeline_path,
+                               const std::string &event_path) {
+    // AoS(Array of Structures)では、1個体の状態を1つの構造体にまとめます。
+    // これにより「個体ごとの更新処理」が読みやすくなり、状態のまとまりを把握しやすくなります。
+    // initializeでは準備に集中し、runではループ本体だけを実行する構成にしています。
+    m_event_logger.open(event_path);
+    m_timeline_logger.open(timeline_path);
+    m_scenario = loadScenario(scenario_path);
+    buildStorage(m_scenario);
+    m_end_sec = 24 * 60 * 60;
+    m_detect_range_m = static_cast<int>(m_scenario.getPerformance().getScout().getDetectRangeM());
+    m_comm_range_m = static_cast<int>(m_scenario.getPerformance().getScout().getCommRangeM());
+    m_bom_range_m = static_cast<int>(m_scenario.getPerformance().getAttacker().getBomRangeM());
+    m_initialized = true;
+}
+
+void AosSimulation::run() {
+    if (!m_initialized) {
+        throw std::runtime_error("simulation: initialize must be called before run");
+    }
+
+    // AoSでは「1個体のまとまり」を順番に更新し、イベント判定とログ出力を行います。
+    m_scheduler.rewind();
+    for (int time_sec = 0; time_sec <= m_end_sec; ++time_sec) {
+        updatePositions(time_sec);
+
+        // 空間格子は毎秒作り直しますが、配列は使い回すので2秒目以降はヒープ確保が起きません。
+        m_spatial_grid.build(m_storage, static_cast<double>(m_detect_range_m));
+
+        // 空間格子は全員の位置がそろってから読むだけなので、探知は斥候ごとに並列で進められます。
+        // イベントは斥候ごとの一時領域にため、全チャンクが終わってから添字の順に書き出します。
+        m_pool.parallelFor(m_storage.objects.size(), m_chunk_size, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (m_storage.objects[i].role == jsonobj::Role::SCOUT) {
+                    updateDetectionForScout(time_sec, i, m_spatial_grid, m_pending_events[i]);
+                }
+            }
+        });
+        flushPendingEvents();
+
+        m_pool.parallelFor(m_storage.objects.size(), m_chunk_size, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (m_storage.objects[i].role == jsonobj::Role::ATTACKER) {
+                    emitDetonationForAttacker(time_sec, i, m_pending_events[i]);
+                }
+            }
+        });
+        flushPendingEvents();
+
+        m_timeline_logger.write(time_sec, m_storage, *this);
+    }
+}
+
+void AosSimulation::updatePositions(int time_sec) {
+    // 開始時刻を迎えたオブジェクトを移動中リストに加え、移動中のものだけを1件ずつ更新します。
+    // 司令官・開始前・移動完了後のオブジェクトは位置が変わらないので、前回の位置をそのまま使います。
+    // 移動中リストをチャンクに分け、各スレッドが担当するオブジェクトの位置だけを書き換えます。
+    // 1体の位置はその個体の経路だけで決まるため、処理の順番が変わっても結果は同じです。
+    m_scheduler.activate(time_sec);
+    const std::vector<size_t> &active = m_scheduler.active();
+    m_pool.parallelFor(active.size(), m_chunk_size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            updateObjectPosition(m_storage.objects[active[i]], time_sec);
+        }
+    });
+
+    // 最後の経路点に着いたオブジェクトは、以降ずっと同じ位置なので移動中リストから外します。
+    m_scheduler.retireIf([&](size_t index) {
+        const AosObject &obj = m_storage.objects[index];
+        double elapsed = static_cast<double>(time_sec - obj.start_sec);
+        return obj.segment_count == 0 || elapsed >= obj.total_duration_sec;
+    });
+}
+
+void AosSimulation::updateObjectPosition(AosObject &obj, int time_sec) {
+    // AoSでは個体単位で状態を更新するため、1件ずつ読みやすく処理できます。
+    // 経路点や区間のデータは共有プールにあり、個体が持つoffset/countでその範囲を参照します。
+    if (obj.route_count == 0) {
+        obj.position = Ecef{0.0, 0.0, 0.0};
+        return;
+    }
+
+    const RoutePoint &first = m_storage.route_points[obj.route_offset];
+    const RoutePoint &last = m_storage.route_points[obj.route_offset + obj.route_count - 1];
+
+    if (obj.role == jsonobj::Role::COMMANDER) {
+        obj.position = first.ecef;
+        return;
+    }
+
+    if (time_sec < obj.start_sec) {
+        obj.position = first.ecef;
+        return;
+    }
+
+    if (obj.segment_count == 0) {
+        obj.position = last.ecef;
+        return;
+    }
+
+    double elapsed = static_cast<double>(time_sec - obj.start_sec);
+    if (elapsed >= obj.total_duration_sec) {
+        obj.position = last.ecef;
+        return;
+    }
+
+    // 前回の区間番号から前へ進めるだけで済むため、毎秒の二分探索を省けます。
+    obj.segment_cursor = static_cast<uint32_t>(advanceSegmentCursor(
+        m_storage.segment_end_secs.data() + obj.segment_offset, obj.segment_count, obj.segment_cursor, elapsed));
+    size_t segment_index = obj.segment_cursor;
+    if (segment_index >= obj.segment_count) {
+        obj.position = last.ecef;
+        return;
+    }
+
+    // 区間の始点と速度ベクトルは前計算済みなので、掛け算と足し算だけで位置が求まります。
+    // 速度0の区間や長さ0の区間も、速度0のレコードとして同じ式で扱えます。
+    obj.position = segmentPosition(m_storage.segment_motions[obj.segment_offset + segment_index], elapsed);
+}
+
+void AosSimulation::updateDetectionForScout(
+    int time_sec,
+    size_t scout_index,
+    const SpatialGrid &spatial_grid,
+    std::vector<nlohmann::json> &events) {
+    // 探知範囲が無効なら処理を省略し、無駄な計算を避けます。
+    if (m_detect_range_m <= 0) {
+        return;
+    }
+
+    const AosObject &scout = m_storage.objects[scout_index];
+    AosObjectInfo &scout_info = m_storage.infos[scout_index];
+    std::unordered_map<std::string, DetectionInfo> current_detected;
+    CellKey base = cellKey(scout.position, static_cast<double>(m_detect_range_m));
+
+    for (int dx = -1; dx <= 1; ++dx) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dz = -1; dz <= 1; ++dz) {
+                CellKey key{base.x + dx, base.y + dy, base.z + dz};
+                for (int index : spatial_grid.cell(key)) {
+                    size_t other_index = static_cast<size_t>(index);
+                    if (other_index == scout_index) {
+                        continue;
+                    }
+                    const AosObject &other = m_storage.objects[other_index];
+                    if (other.team_index == scout.team_index) {
+                        continue;
+                    }
+                    double distance = distanceEcef(scout.position, other.position);
+                    if (distance > static_cast<double>(m_detect_range_m)) {
+                        continue;
+                    }
+                    double lat = 0.0;
+                    double lon = 0.0;
+                    double alt = 0.0;
+                    ecefToGeodetic(other.position, lat, lon, alt);
+                    DetectionInfo info;
+                    info.lat_deg = lat;
+                    info.lon_deg = lon;
+                    info.alt_m = alt;
+                    info.distance_m = static_cast<int>(std::llround(distance));
+                    current_detected.emplace(m_storage.infos[other_index].object_id, info);
+                }
+            }
+        }
+    }
+
+    for (const auto &entry : current_detected) {
+        if (scout_info.detect_state.find(entry.first) != scout_info.detect_state.end()) {
+            continue;
+        }
+        const DetectionInfo &info = entry.second;
+        jsonobj::DetectionEvent event;
+        event.setEventType("detection");
+        event.setDetectionAction(jsonobj::DetectionAction::FOUND);
+        event.setTimeSec(time_sec);
+        event.setScountId(scout_info.object_id);
+        event.setLatDeg(info.lat_deg);
+        event.setLonDeg(info.lon_deg);
+        event.setAltM(info.alt_m);
+        event.setDistanceM(info.distance_m);
+        event.setDetectId(entry.first);
+        nlohmann::json json_event;
+        jsonobj::to_json(json_event, event);
+        events.push_back(std::move(json_event));
+    }
+
+    for (const auto &entry : scout_info.detect_state) {
+        if (current_detected.find(entry.first) != current_detected.end()) {
+            continue;
+        }
+        const DetectionInfo &info = entry.second;
+        jsonobj::DetectionEvent event;
+        event.setEventType("detection");
+        event.setDetectionAction(jsonobj::DetectionAction::LOST);
+        event.setTimeSec(time_sec);
+        event.setScountId(scout_info.object_id);
+        event.setLatDeg(info.lat_deg);
+        event.setLonDeg(info.lon_deg);
+        event.setAltM(info.alt_m);
+        event.setDistanceM(info.distance_m);
+        event.setDetectId(entry.first);
+        nlohmann::json json_event;
+        jsonobj::to_json(json_event, event);
+        events.push_back(std::move(json_event));
+    }
+
+    scout_info.detect_state = std::move(current_detected);
+}
+
+void AosSimulation::emitDetonationForAttacker(int time_sec,
+                                              size_t attacker_index,
+                                              std::vector<nlohmann::json> &events) {
+    // 爆破イベントは攻撃役の責務として扱い、1回だけ発火させます。
+    const AosObject &attacker = m_storage.objects[attacker_index];
+    AosObjectInfo &attacker_info = m_storage.infos[attacker_index];
+    if (attacker_info.has_detonated) {
+        return;
+    }
+    if (!std::isfinite(attacker.total_duration_sec)) {
+        return;
+    }
+    if (static_cast<double>(time_sec) <
+        static_cast<double>(attacker.start_sec) + attacker.total_duration_sec) {
+        return;
+    }
+
+    double lat = 0.0;
+    double lon = 0.0;
+    double alt = 0.0;
+    ecefToGeodetic(attacker.position, lat, lon, alt);
+    jsonobj::DetonationEvent event;
+    event.setEventType("detonation");
+    event.setTimeSec(time_sec);
+    event.setAttackerId(attacker_info.object_id);
+    event.setLatDeg(lat);
+    event.setLonDeg(lon);
+    event.setAltM(alt);
+    event.setBomRangeM(m_bom_range_m);
+    nlohmann::json json_event;
+    jsonobj::to_json(json_event, event);
+    events.push_back(std::move(json_event));
+    attacker_info.has_detonated = true;
+}
+
+void AosSimulation::flushPendingEvents() {
+    // イベントログへの書き込みは1スレッドだけで行い、直列版と同じ「添字の順」を守ります。
+    for (auto &events : m_pending_events) {
+        for (const auto &event : events) {
+            m_event_logger.write(event);
+        }
+        events.clear();
+    }
+}
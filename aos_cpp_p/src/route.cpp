@@ -0,0 +1,99 @@
+#include "route.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+std::vector<RoutePoint> buildRoute(const std::vector<jsonobj::Waypoint> &route) {
+    std::vector<RoutePoint> result;
+    result.reserve(route.size());
+    for (const auto &wp : route) {
+        // 測地座標からECEFに変換して、後続の位置補間を簡単にします。
+        // 変換は共通処理として関数に集約し、各所で同じ式を持たないようにします。
+        result.push_back(RoutePoint{
+            wp.getLatDeg(),
+            wp.getLonDeg(),
+            wp.getAltM(),
+            wp.getSpeedsKph(),
+            geodeticToEcef(wp.getLatDeg(), wp.getLonDeg(), wp.getAltM()),
+        });
+    }
+    return result;
+}
+
+std::pair<std::vector<double>, double> buildSegmentTimes(const std::vector<RoutePoint> &route) {
+    if (route.size() < 2) {
+        return {std::vector<double>{}, 0.0};
+    }
+
+    std::vector<double> segment_ends;
+    segment_ends.reserve(route.size() - 1);
+    double acc = 0.0;
+
+    for (size_t i = 0; i + 1 < route.size(); ++i) {
+        // 区間距離と速度から移動に必要な秒数を算出します。
+        // 前計算しておくことで、更新ループ内の負荷を減らします。
+        double distance = distanceEcef(route[i].ecef, route[i + 1].ecef);
+        double speed_mps = (route[i].speeds_kph * 1000.0) / 3600.0;
+        double duration = std::numeric_limits<double>::infinity();
+        if (speed_mps > 0.0) {
+            duration = distance / speed_mps;
+        }
+        acc += duration;
+        segment_ends.push_back(acc);
+    }
+
+    return {segment_ends, acc};
+}
+
+std::vector<SegmentMotion> buildSegmentMotions(const std::vector<RoutePoint> &route,
+                                               const std::vector<double> &segment_end_secs) {
+    std::vector<SegmentMotion> motions;
+    motions.reserve(segment_end_secs.size());
+    for (size_t i = 0; i < segment_end_secs.size(); ++i) {
+        // 区間の開始時刻は1つ前の区間の終了時刻です。累積値をそのまま使い、区間判定と食い違わないようにします。
+        double start_sec = (i == 0) ? 0.0 : segment_end_secs[i - 1];
+        double duration = segment_end_secs[i] - start_sec;
+        const Ecef &a = route[i].ecef;
+        const Ecef &b = route[i + 1].ecef;
+
+        SegmentMotion motion{a, Ecef{0.0, 0.0, 0.0}, start_sec};
+        if (duration <= 0.0) {
+            // 長さ0の区間は一瞬で通過するため、終点に留まる扱いにします。
+            motion.start = b;
+        } else if (std::isfinite(duration)) {
+            // 1秒あたりの移動量(速度ベクトル)を前計算し、補間時の割り算をなくします。
+            motion.velocity_mps = Ecef{
+                (b.x - a.x) / duration,
+                (b.y - a.y) / duration,
+                (b.z - a.z) / duration,
+            };
+        }
+        // 所要時間が無限大(速度0)の区間は、速度0のまま始点に留まります。
+        motions.push_back(motion);
+    }
+    return motions;
+}
+
+size_t seekSegmentCursor(const double *segment_end_secs, size_t segment_count, double elapsed) {
+    // 区間終了時刻は累積値なので単調増加しており、二分探索で位置を特定できます。
+    const double *end = segment_end_secs + segment_count;
+    const double *it = std::upper_bound(segment_end_secs, end, elapsed);
+    return static_cast<size_t>(it - segment_end_secs);
+}
+
+size_t advanceSegmentCursor(const double *segment_end_secs,
+                            size_t segment_count,
+                            size_t cursor,
+                            double elapsed) {
+    // 前回の区間より手前に戻っていたら、前方へ進めるだけでは求まらないのでシークします。
+    if (cursor > segment_count ||
+        (cursor > 0 && segment_end_secs[cursor - 1] > elapsed)) {
+        return seekSegmentCursor(segment_end_secs, segment_count, elapsed);
+    }
+    // 1秒刻みでは区間をまたぐことはまれなので、ほとんどの場合はループを1回も回らずに終わります。
+    while (cursor < segment_count && segment_end_secs[cursor] <= elapsed) {
+        ++cursor;
+    }
+    return cursor;
+}
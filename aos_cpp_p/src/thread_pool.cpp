@@ -0,0 +1,141 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+constexpr size_t kDefaultChunkSize = 256;
+
+/**
+ * @brief 環境変数を正の整数として読み取ります。未指定や不正な値のときは0を返します。
+ */
+size_t parsePositiveEnv(const char *name) {
+    const char *value = std::getenv(name);
+    if (value == nullptr || *value == '\0') {
+        return 0;
+    }
+    char *end = nullptr;
+    long long parsed = std::strtoll(value, &end, 10);
+    if (end == value || *end != '\0' || parsed <= 0) {
+        return 0;
+    }
+    return static_cast<size_t>(parsed);
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t thread_count) {
+    // 呼び出し元スレッドも作業に加わるので、作業用スレッドは1本少なく作ります。
+    size_t worker_count = std::max<size_t>(thread_count, 1) - 1;
+    m_workers.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+        m_workers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_start_cv.notify_all();
+    for (auto &worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, size_t chunk_size, const std::function<void(size_t, size_t)> &task) {
+    if (count == 0) {
+        return;
+    }
+    chunk_size = std::max<size_t>(chunk_size, 1);
+    // チャンクが1つしかないときや作業用スレッドがないときは、受け渡しの手間を省いてその場で処理します。
+    if (m_workers.empty() || count <= chunk_size) {
+        for (size_t begin = 0; begin < count; begin += chunk_size) {
+            task(begin, std::min(begin + chunk_size, count));
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_count = count;
+        m_chunk_size = chunk_size;
+        m_next_begin.store(0);
+        m_error = nullptr;
+        m_running_workers = m_workers.size();
+        ++m_generation;
+    }
+    m_start_cv.notify_all();
+
+    // 呼び出し元も同じようにチャンクを取り出して処理し、最後に全員の終了を待ちます。
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_cv.wait(lock, [this]() { return m_running_workers == 0; });
+    m_task = nullptr;
+    if (m_error) {
+        std::exception_ptr error = m_error;
+        m_error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::workerLoop() {
+    size_t seen_generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start_cv.wait(lock, [&]() { return m_stopping || m_generation != seen_generation; });
+            if (m_stopping) {
+                return;
+            }
+            seen_generation = m_generation;
+        }
+
+        runChunks();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_running_workers;
+        }
+        m_done_cv.notify_one();
+    }
+}
+
+void ThreadPool::runChunks() {
+    // 次に処理する先頭の添字をアトミックに進めることで、チャンクを重複なく取り出します。
+    while (true) {
+        size_t begin = m_next_begin.fetch_add(m_chunk_size);
+        if (begin >= m_count) {
+            return;
+        }
+        size_t end = std::min(begin + m_chunk_size, m_count);
+        try {
+            (*m_task)(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_error) {
+                m_error = std::current_exception();
+            }
+        }
+    }
+}
+
+size_t resolveChunkSize() {
+    // チャンクサイズは環境変数で外から変えられるようにし、計測や比較をしやすくします。
+    size_t value = parsePositiveEnv("CHUNK_SIZE");
+    return value > 0 ? value : kDefaultChunkSize;
+}
+
+size_t resolveParallelism() {
+    // 並列数を指定しないときは、CPUが同時に実行できるスレッド数を使います。
+    size_t value = parsePositiveEnv("PARALLELISM");
+    if (value > 0) {
+        return value;
+    }
+    return std::max<unsigned int>(std::thread::hardware_concurrency(), 1);
+}
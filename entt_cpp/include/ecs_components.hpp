@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -82,9 +83,32 @@ struct PositionComponent {
 struct RouteComponent {
     std::vector<RoutePoint> points;
     std::vector<double> segment_end_secs;
+    /**
+     * @brief 区間ごとの始点・速度ベクトル・開始時刻です。位置補間はこれだけを読みます。
+     */
+    std::vector<SegmentMotion> segment_motions;
     double total_duration = 0.0;
 };
 
+/**
+ * @brief 現在いる区間番号(カーソル)を保持するコンポーネントです。
+ *
+ * @details RouteComponentは読み取り専用のまま、毎秒書き換わる値だけを別コンポーネントに分けます。
+ *          前回の区間番号から前へ進めることで、毎秒の二分探索を省きます。
+ */
+struct SegmentCursorComponent {
+    size_t index = 0;
+};
+
+/**
+ * @brief 「いま移動中である」ことを示す目印(タグ)コンポーネントです。
+ *
+ * @details データを持たない空の構造体で、付いているかどうかだけに意味があります。
+ *          開始時刻を迎えたら付け、最後の経路点に着いたら外すことで、
+ *          位置更新のviewを移動中のエンティティだけに絞り込みます。
+ */
+struct MovingTag {};
+
 /**
  * @brief 探知距離を保持するコンポーネントです。
  *
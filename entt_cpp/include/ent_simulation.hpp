@@ -6,7 +6,9 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ecs_components.hpp"
@@ -58,26 +60,38 @@ private:
      * @details ここでエンティティとコンポーネントをそろえることで、run中の処理を単純化します。
      */
     void buildRegistry(const jsonobj::Scenario &scenario);
+    /**
+     * @brief 開始時刻を迎えたエンティティにMovingTagを付けます。
+     *
+     * @details 待機列は開始時刻順に並んでいるので、先頭から時刻が来たものだけを取り出します。
+     */
+    void activateMovers(int time_sec);
+    /**
+     * @brief 最後の経路点に着いたエンティティからMovingTagを外します。
+     */
+    void retireMovers(int time_sec);
     /**
      * @brief 斥候1体分の探知・失探イベントを生成します。
      *
-     * @details 空間ハッシュの近傍だけを調べ、イベント出力を最小限に抑えます。
+     * @details 空間格子の近傍だけを調べ、イベント出力を最小限に抑えます。
      */
 
     /**
      * @brief 1体分の位置を計算し、ECEF座標として返します。
      *
-     * @details 役割と開始時刻、ルート情報を入力として、補間結果だけを返す純粋計算です。
+     * @details 役割と開始時刻、ルート情報を入力として補間結果を返します。
+     *          区間番号のカーソルだけは次の秒のために書き換えます。
      */
     Ecef updatePositions(const RoleComponent &role,
                          const StartSecComponent &start,
                          const RouteComponent &route,
+                         SegmentCursorComponent &cursor,
                          int time_sec);
 
     void updateDetections(
         int time_sec,
         entt::entity scout_entity,
-        const std::unordered_map<CellKey, std::vector<entt::entity>, CellKeyHash> &spatial_hash);
+        const SpatialGrid &spatial_grid);
     /**
      * @brief 攻撃役1体分の爆破イベントを生成します。
      *
@@ -89,6 +103,13 @@ private:
     jsonobj::Scenario m_scenario{};
     entt::registry m_registry{};
     std::vector<entt::entity> m_entities{};
+    /**
+     * @brief 移動する可能性のあるエンティティを(開始時刻, エンティティ)の組で開始時刻順に並べた待機列です。
+     */
+    std::vector<std::pair<int, entt::entity>> m_pending_movers{};
+    size_t m_next_pending_mover = 0;
+    std::vector<entt::entity> m_arrived_movers{};
+    SpatialGrid m_spatial_grid{};
     TimelineLogger m_timeline_logger{};
     EventLogger m_event_logger{};
     int m_end_sec = 24 * 60 * 60;
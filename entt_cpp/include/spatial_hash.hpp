@@ -1,12 +1,13 @@
 /**
  * @file spatial_hash.hpp
- * @brief 空間ハッシュで近傍探索を行うための宣言をまとめたヘッダです。
+ * @brief 空間格子で近傍探索を行うための宣言をまとめたヘッダです。
  *
  * @details 探知対象の候補を減らし、距離計算の回数を抑える目的で使用します。
  */
 #pragma once
 
-#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 #include "entt/entt.hpp"
@@ -26,14 +27,16 @@ struct CellKey {
 /**
  * @brief CellKey同士の等価判定を定義します。
  *
- * @details unordered_mapでキー比較が必要になるため、3軸が同じかを明示的に比較します。
+ * @details ハッシュ表でキー比較が必要になるため、3軸が同じかを明示的に比較します。
  */
 inline bool operator==(const CellKey &a, const CellKey &b) {
     return a.x == b.x && a.y == b.y && a.z == b.z;
 }
 
 /**
- * @brief CellKeyをunordered_mapで使えるようにするハッシュ関数です。
+ * @brief CellKeyのハッシュ値を計算する関数オブジェクトです。
+ *
+ * @details 空間格子のハッシュ表は下位ビットで位置を決めるため、3軸の値を掛け算で全ビットに混ぜてから返します。
  */
 struct CellKeyHash {
     size_t operator()(const CellKey &key) const;
@@ -45,11 +48,62 @@ struct CellKeyHash {
 CellKey cellKey(const Ecef &pos, double cell_size);
 
 /**
- * @brief ECSの位置コンポーネントから空間ハッシュを構築します。
+ * @brief 空間を立方体セルに区切り、セルごとのエンティティを1本の配列にまとめた空間格子です。
  *
- * @details 探知処理の前に候補を絞り込むための前処理です。
+ * @details セルごとにvectorを持つハッシュ表は、毎秒セルの数だけヒープ確保が起きます。
+ *          この格子は次の数回の線形な走査だけで作り直します(CSR形式: 圧縮行格納)。
+ *          1. 各オブジェクトのセル座標を求め、ハッシュ表でセル番号を振りながらセルごとの数を数えます。
+ *          2. 数の累積和から、各セルの先頭位置(m_cell_starts)を求めます。
+ *          3. エンティティを先頭位置へ順に書き込みます(計数ソート)。
+ *          書き込みは渡したエンティティ一覧の順なので、セル内の並びはハッシュ表に追加していたときと同じです。
+ *          配列とハッシュ表は使い回し、オブジェクト数が増えない限り作り直しでヒープ確保は起きません。
  */
-std::unordered_map<CellKey, std::vector<entt::entity>, CellKeyHash> buildSpatialHash(
-    const entt::registry &registry,
-    const std::vector<entt::entity> &entities,
-    double cell_size);
+class SpatialGrid {
+public:
+    /**
+     * @brief 1セル分のエンティティの範囲です。範囲for文でそのまま回せます。
+     */
+    struct CellRange {
+        const entt::entity *first = nullptr;
+        const entt::entity *last = nullptr;
+        const entt::entity *begin() const { return first; }
+        const entt::entity *end() const { return last; }
+    };
+
+    /**
+     * @brief ECSの位置コンポーネントから格子を作り直します。
+     *
+     * @details 探知処理の前に候補を絞り込むための前処理です。cell_sizeが0以下のときは空の格子になります。
+     */
+    void build(const entt::registry &registry, const std::vector<entt::entity> &entities, double cell_size);
+    /**
+     * @brief 指定したセルにいるエンティティの範囲を返します。誰もいないセルは空の範囲です。
+     */
+    CellRange cell(const CellKey &key) const;
+
+private:
+    /**
+     * @brief ハッシュ表の1枠です。stampが今回の作り直しの番号と同じ枠だけが使用中です。
+     *
+     * @details 番号で使用中かどうかを見分けるため、作り直しのたびに表全体を消す必要がありません。
+     */
+    struct Slot {
+        CellKey key{0, 0, 0};
+        uint32_t cell = 0;
+        uint32_t stamp = 0;
+    };
+
+    /**
+     * @brief keyが入っている枠、なければ次に使う空き枠の位置を線形探索で探します。
+     */
+    size_t findSlot(const CellKey &key) const;
+
+    std::vector<Slot> m_slots{};
+    std::vector<uint32_t> m_object_cells{};
+    std::vector<uint32_t> m_cell_starts{};
+    std::vector<uint32_t> m_cell_cursors{};
+    std::vector<entt::entity> m_items{};
+    size_t m_slot_mask = 0;
+    size_t m_cell_count = 0;
+    uint32_t m_stamp = 0;
+};
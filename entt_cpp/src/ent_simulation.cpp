@@ -74,6 +74,8 @@ void EnttSimulation::buildRegistry(const jsonobj::Scenario &scenario)
     // ここでレジストリを組み立てておくと、run中の処理が単純になります。
     m_registry.clear();
     m_entities.clear();
+    m_pending_movers.clear();
+    m_next_pending_mover = 0;
 
     for (const auto &team : scenario.getTeams())
     {
@@ -85,6 +87,8 @@ void EnttSimulation::buildRegistry(const jsonobj::Scenario &scenario)
             RouteComponent route_component;
             route_component.points = std::move(route);
             route_component.segment_end_secs = std::move(segment_info.first);
+            route_component.segment_motions =
+                buildSegmentMotions(route_component.points, route_component.segment_end_secs);
             route_component.total_duration = segment_info.second;
 
             Ecef start_ecef{0.0, 0.0, 0.0};
@@ -101,6 +105,7 @@ void EnttSimulation::buildRegistry(const jsonobj::Scenario &scenario)
             m_registry.emplace<StartSecComponent>(entity, static_cast<int>(obj.getStartSec()));
             m_registry.emplace<PositionComponent>(entity, PositionComponent{start_ecef});
             m_registry.emplace<RouteComponent>(entity, std::move(route_component));
+            m_registry.emplace<SegmentCursorComponent>(entity);
 
             if (obj.getRole() == jsonobj::Role::SCOUT)
             {
@@ -112,8 +117,59 @@ void EnttSimulation::buildRegistry(const jsonobj::Scenario &scenario)
                 m_registry.emplace<DetonationRangeComponent>(entity, m_bom_range_m);
                 m_registry.emplace<DetonationStateComponent>(entity);
             }
+
+            // 経路を持つ司令官以外のエンティティだけが移動します。
+            // 司令官や経路なしのエンティティは初期位置のままなので、待機列に入れません。
+            const auto &placed_route = m_registry.get<RouteComponent>(entity);
+            if (obj.getRole() != jsonobj::Role::COMMANDER && !placed_route.points.empty())
+            {
+                m_pending_movers.emplace_back(static_cast<int>(obj.getStartSec()), entity);
+            }
         }
     }
+
+    // 開始時刻の早い順に並べておき、毎秒は待機列の先頭だけを見れば済むようにします。
+    std::stable_sort(m_pending_movers.begin(), m_pending_movers.end(),
+              [](const std::pair<int, entt::entity> &a, const std::pair<int, entt::entity> &b)
+              {
+                  return a.first < b.first;
+              });
+}
+
+/**
+ * @brief 開始時刻を迎えたエンティティにMovingTagを付けます。
+ *
+ * @details タグを付けたエンティティだけが位置更新のviewに現れます。
+ */
+void EnttSimulation::activateMovers(int time_sec)
+{
+    while (m_next_pending_mover < m_pending_movers.size() &&
+           m_pending_movers[m_next_pending_mover].first <= time_sec)
+    {
+        m_registry.emplace<MovingTag>(m_pending_movers[m_next_pending_mover].second);
+        ++m_next_pending_mover;
+    }
+}
+
+/**
+ * @brief 最後の経路点に着いたエンティティからMovingTagを外します。
+ *
+ * @details view走査中にコンポーネントを外すと走査対象が変わるため、
+ *          いったん一覧に集めてから、走査の後でまとめて外します。
+ */
+void EnttSimulation::retireMovers(int time_sec)
+{
+    m_arrived_movers.clear();
+    auto view = m_registry.view<MovingTag, StartSecComponent, RouteComponent>();
+    view.each([&](entt::entity entity, const StartSecComponent &start, const RouteComponent &route)
+              {
+                  double elapsed = static_cast<double>(time_sec - start.value);
+                  if (route.segment_end_secs.empty() || elapsed >= route.total_duration)
+                  {
+                      m_arrived_movers.push_back(entity);
+                  }
+              });
+    m_registry.remove<MovingTag>(m_arrived_movers.begin(), m_arrived_movers.end());
 }
 
 /**
@@ -157,29 +213,36 @@ void EnttSimulation::run()
     // 1秒ごとの更新も「位置更新」「探知」「爆破」の順で明示的に呼び出します。
     // EnTTはSystem専用の型を用意しないため、ここではレジストリに対する処理を
     // 手続き的に並べて「更新の流れ」を見える化しています。
+    m_registry.clear<MovingTag>();
+    m_next_pending_mover = 0;
     for (int time_sec = 0; time_sec <= m_end_sec; ++time_sec)
     {
-        // 位置更新は「Position/Route/Start/Roleを持つエンティティだけ」に適用します。
-        // viewは該当コンポーネントを持つ集合だけを返すので、不要な分岐を減らせます。
+        // 位置更新は「MovingTagを持つ(=いま移動中の)エンティティだけ」に適用します。
+        // 司令官・開始前・移動完了後のエンティティはタグを持たないので、viewに現れず位置もそのままです。
         // ECSでは「必要なデータを持つものだけを対象にする」のが基本です。
-        auto view = m_registry.view<RoleComponent,
+        activateMovers(time_sec);
+        auto view = m_registry.view<MovingTag,
+                                    RoleComponent,
                                     StartSecComponent,
                                     RouteComponent,
+                                    SegmentCursorComponent,
                                     PositionComponent>();
         view.each([&](const RoleComponent &role,
                       const StartSecComponent &start,
                       const RouteComponent &route,
+                      SegmentCursorComponent &cursor,
                       PositionComponent &pos)
                   {
-                      // 位置計算は純粋計算として切り出し、副作用の場所を明確にします。
-                      pos.ecef = updatePositions(role, start, route, time_sec);
+                      // 位置計算は関数として切り出し、書き換えるのはカーソルと位置だけにします。
+                      pos.ecef = updatePositions(role, start, route, cursor, time_sec);
                   });
+        retireMovers(time_sec);
 
-        // 探知処理は近傍探索が重いので、空間ハッシュで候補を絞ります。
+        // 探知処理は近傍探索が重いので、空間格子で候補を絞ります。
         // ここではセルサイズを「シナリオ共通の探知距離」に合わせています。
         // 各エンティティごとの距離判定は後段のupdateDetectionsで行います。
-        std::unordered_map<CellKey, std::vector<entt::entity>, CellKeyHash> spatial_hash =
-            buildSpatialHash(m_registry, m_entities, static_cast<double>(m_detect_range_m));
+        // 格子の配列は使い回すので、2秒目以降の作り直しではヒープ確保が起きません。
+        m_spatial_grid.build(m_registry, m_entities, static_cast<double>(m_detect_range_m));
 
         // DetectionRangeComponentを持つエンティティだけを対象にします。
         // ECSでは「役割の分岐」よりも「コンポーネントの有無」で対象を決めます。
@@ -187,7 +250,7 @@ void EnttSimulation::run()
         {
             if (m_registry.all_of<DetectionRangeComponent>(entity))
             {
-                updateDetections(time_sec, entity, spatial_hash);
+                updateDetections(time_sec, entity, m_spatial_grid);
             }
         }
 
@@ -211,12 +274,12 @@ void EnttSimulation::run()
 /**
  * @brief 斥候1体分の探知イベントを更新します。
  *
- * @details 空間ハッシュで候補を絞り、距離計算とFOUND/LOSTの判定を行います。
+ * @details 空間格子で候補を絞り、距離計算とFOUND/LOSTの判定を行います。
  */
 void EnttSimulation::updateDetections(
     int time_sec,
     entt::entity scout_entity,
-    const std::unordered_map<CellKey, std::vector<entt::entity>, CellKeyHash> &spatial_hash)
+    const SpatialGrid &spatial_grid)
 {
     // 探知範囲が無効なら処理を省略し、無駄な計算を避けます。
     const auto &range = m_registry.get<DetectionRangeComponent>(scout_entity);
@@ -238,12 +301,7 @@ void EnttSimulation::updateDetections(
             for (int dz = -1; dz <= 1; ++dz)
             {
                 CellKey key{base.x + dx, base.y + dy, base.z + dz};
-                auto it = spatial_hash.find(key);
-                if (it == spatial_hash.end())
-                {
-                    continue;
-                }
-                for (entt::entity other_entity : it->second)
+                for (entt::entity other_entity : spatial_grid.cell(key))
                 {
                     if (other_entity == scout_entity)
                     {
@@ -376,15 +434,17 @@ void EnttSimulation::emitDetonations(int time_sec, entt::entity attacker_entity)
 /**
  * @brief 1体分の位置を計算し、ECEF座標として返します。
  *
- * @details 役割と開始時刻、ルート情報から補間位置を求める純粋計算です。
+ * @details 役割と開始時刻、ルート情報から補間位置を求めます。
+ *          区間番号のカーソルは前回の値から前へ進めるだけなので、二分探索を毎秒行わずに済みます。
  */
 Ecef EnttSimulation::updatePositions(const RoleComponent &role,
                                      const StartSecComponent &start,
                                      const RouteComponent &route,
+                                     SegmentCursorComponent &cursor,
                                      int time_sec)
 {
-    // 位置更新の計算だけを純粋関数として切り出し、副作用を持たない形にします。
-    // 入力が同じなら必ず同じ結果になるため、更新ループの理解が容易になります。
+    // 位置更新の計算だけを関数として切り出し、書き換える状態はカーソルだけに限定します。
+    // カーソルは探索を省くための補助情報で、入力が同じなら補間結果は必ず同じになります。
     size_t route_count = route.points.size();
     if (route_count == 0)
     {
@@ -418,10 +478,11 @@ Ecef EnttSimulation::updatePositions(const RoleComponent &role,
         return last.ecef;
     }
 
-    auto it = std::upper_bound(route.segment_end_secs.begin(),
-                               route.segment_end_secs.end(),
-                               elapsed);
-    size_t segment_index = static_cast<size_t>(std::distance(route.segment_end_secs.begin(), it));
+    cursor.index = advanceSegmentCursor(route.segment_end_secs.data(),
+                                        segment_count,
+                                        cursor.index,
+                                        elapsed);
+    size_t segment_index = cursor.index;
 
     if (segment_index >= segment_count)
     {
@@ -429,28 +490,7 @@ Ecef EnttSimulation::updatePositions(const RoleComponent &role,
         return last.ecef;
     }
 
-    double segment_end = route.segment_end_secs[segment_index];
-    double segment_start = (segment_index == 0)
-                               ? 0.0
-                               : route.segment_end_secs[segment_index - 1];
-    double segment_duration = segment_end - segment_start;
-    if (segment_duration <= 0.0)
-    {
-        const RoutePoint &target = route.points[segment_index + 1];
-        return target.ecef;
-    }
-    if (!std::isfinite(segment_duration))
-    {
-        const RoutePoint &target = route.points[segment_index];
-        return target.ecef;
-    }
-
-    double t = (elapsed - segment_start) / segment_duration;
-    const RoutePoint &a = route.points[segment_index];
-    const RoutePoint &b = route.points[segment_index + 1];
-    return Ecef{
-        a.ecef.x + (b.ecef.x - a.ecef.x) * t,
-        a.ecef.y + (b.ecef.y - a.ecef.y) * t,
-        a.ecef.z + (b.ecef.z - a.ecef.z) * t,
-    };
+    // 区間の始点と速度ベクトルは構築時に前計算してあるので、掛け算と足し算だけで位置が求まります。
+    // 速度0の区間や長さ0の区間も、速度0のレコードとして同じ式で扱えます。
+    return segmentPosition(route.segment_motions[segment_index], elapsed);
 }
@@ -6,6 +6,8 @@
  */
 #include "route.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 /**
@@ -59,3 +61,70 @@ std::pair<std::vector<double>, double> buildSegmentTimes(const std::vector<Route
 
     return {segment_ends, acc};
 }
+
+/**
+ * @brief 区間ごとの始点・速度ベクトル・開始時刻をまとめた移動レコードを作成します。
+ *
+ * @details 速度ベクトルを前計算しておくことで、位置補間は掛け算と足し算だけになります。
+ */
+std::vector<SegmentMotion> buildSegmentMotions(const std::vector<RoutePoint> &route,
+                                               const std::vector<double> &segment_end_secs) {
+    std::vector<SegmentMotion> motions;
+    motions.reserve(segment_end_secs.size());
+    for (size_t i = 0; i < segment_end_secs.size(); ++i) {
+        // 区間の開始時刻は1つ前の区間の終了時刻です。累積値をそのまま使い、区間判定と食い違わないようにします。
+        double start_sec = (i == 0) ? 0.0 : segment_end_secs[i - 1];
+        double duration = segment_end_secs[i] - start_sec;
+        const Ecef &a = route[i].ecef;
+        const Ecef &b = route[i + 1].ecef;
+
+        SegmentMotion motion{a, Ecef{0.0, 0.0, 0.0}, start_sec};
+        if (duration <= 0.0) {
+            // 長さ0の区間は一瞬で通過するため、終点に留まる扱いにします。
+            motion.start = b;
+        } else if (std::isfinite(duration)) {
+            // 1秒あたりの移動量(速度ベクトル)を前計算し、補間時の割り算をなくします。
+            motion.velocity_mps = Ecef{
+                (b.x - a.x) / duration,
+                (b.y - a.y) / duration,
+                (b.z - a.z) / duration,
+            };
+        }
+        // 所要時間が無限大(速度0)の区間は、速度0のまま始点に留まります。
+        motions.push_back(motion);
+    }
+    return motions;
+}
+
+/**
+ * @brief 経過時間が属する区間番号を二分探索で求めます。
+ *
+ * @details 時刻が巻き戻ったときなど、前回の区間番号が使えない場合に呼び出されます。
+ */
+size_t seekSegmentCursor(const double *segment_end_secs, size_t segment_count, double elapsed) {
+    // 区間終了時刻は累積値なので単調増加しており、二分探索で位置を特定できます。
+    const double *end = segment_end_secs + segment_count;
+    const double *it = std::upper_bound(segment_end_secs, end, elapsed);
+    return static_cast<size_t>(it - segment_end_secs);
+}
+
+/**
+ * @brief 前回の区間番号から前方へ進めて、経過時間が属する区間番号を求めます。
+ *
+ * @details 時刻が巻き戻っていた場合だけ二分探索へ切り替えます。
+ */
+size_t advanceSegmentCursor(const double *segment_end_secs,
+                            size_t segment_count,
+                            size_t cursor,
+                            double elapsed) {
+    // 前回の区間より手前に戻っていたら、前方へ進めるだけでは求まらないのでシークします。
+    if (cursor > segment_count ||
+        (cursor > 0 && segment_end_secs[cursor - 1] > elapsed)) {
+        return seekSegmentCursor(segment_end_secs, segment_count, elapsed);
+    }
+    // 1秒刻みでは区間をまたぐことはまれなので、ほとんどの場合はループを1回も回らずに終わります。
+    while (cursor < segment_count && segment_end_secs[cursor] <= elapsed) {
+        ++cursor;
+    }
+    return cursor;
+}
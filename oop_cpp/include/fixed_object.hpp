@@ -16,4 +16,12 @@ public:
      * @brief 固定オブジェクトの位置更新を行います。
      */
     void updatePosition(int time_sec) override;
+    /**
+     * @brief 固定オブジェクトは移動しないため、常にfalseを返します。
+     */
+    bool isMovable() const override { return false; }
+    /**
+     * @brief 固定オブジェクトは最初から止まっているため、常にtrueを返します。
+     */
+    bool hasArrived(int /*time_sec*/) const override { return true; }
 };
@@ -11,6 +11,9 @@ class SimObject;
 class Simulation;
 namespace spdlog {
 class logger;
+namespace details {
+class thread_pool;
+}
 }
 
 /**
@@ -57,4 +60,8 @@ private:
      * @brief spdlogの非同期ロガーを保持し、イベント出力をまとめます。
      */
     std::shared_ptr<spdlog::logger> m_logger{};
+    /**
+     * @brief このロガー専用のスレッドプールです。closeで破棄し、書き残しが無いことを保証します。
+     */
+    std::shared_ptr<spdlog::details::thread_pool> m_thread_pool{};
 };
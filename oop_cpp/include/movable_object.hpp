@@ -25,8 +25,24 @@ public:
      * @brief 経路に沿った位置更新を行います。
      */
     void updatePosition(int time_sec) override;
+    /**
+     * @brief 経路を持ち、司令官でなければ移動します。
+     */
+    bool isMovable() const override;
+    /**
+     * @brief 経過時間が移動の所要時間に達していれば、最後の経路点に着いています。
+     */
+    bool hasArrived(int time_sec) const override;
 
 protected:
     std::vector<double> m_segment_end_secs;
+    /**
+     * @brief 区間ごとの始点・速度ベクトル・開始時刻です。経路と区間終了時刻から構築時に作ります。
+     */
+    std::vector<SegmentMotion> m_segment_motions;
+    /**
+     * @brief 前回の更新で使った区間番号です。時刻が進むたびに前方へ進めます。
+     */
+    size_t m_segment_cursor = 0;
     double m_total_duration_sec = 0.0;
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -19,6 +20,19 @@ struct RoutePoint {
     Ecef ecef;
 };
 
+/**
+ * @brief 経路の1区間分の移動を「始点・速度・開始時刻」で表す構造体です。
+ *
+ * @details 区間内の位置は start + velocity_mps * (経過秒 - start_sec) の1式で求まります。
+ *          毎秒2つの経路点から差分と割合(割り算)を計算し直す必要がなくなり、
+ *          更新ループで読むデータも緯度経度や速度を含まないこの7個のdoubleだけになります。
+ */
+struct SegmentMotion {
+    Ecef start;
+    Ecef velocity_mps;
+    double start_sec;
+};
+
 /**
  * @brief シナリオの経路点を計算済みの経路点へ変換します。
  */
@@ -27,3 +41,43 @@ std::vector<RoutePoint> buildRoute(const std::vector<jsonobj::Waypoint> &route);
  * @brief 経路の各区間に必要な時間と総移動時間を計算します。
  */
 std::pair<std::vector<double>, double> buildSegmentTimes(const std::vector<RoutePoint> &route);
+
+/**
+ * @brief 経路と区間終了時刻から、区間ごとの移動レコードを作ります。
+ *
+ * @details 速度0の区間(所要時間が無限大)は始点に、長さ0の区間は終点に留まるよう速度を0にします。
+ *          こうしておくと、どの区間でもsegmentPositionの1式だけで位置が決まります。
+ */
+std::vector<SegmentMotion> buildSegmentMotions(const std::vector<RoutePoint> &route,
+                                               const std::vector<double> &segment_end_secs);
+
+/**
+ * @brief 区間の移動レコードから、経過秒数elapsedでの位置を求めます。
+ */
+inline Ecef segmentPosition(const SegmentMotion &motion, double elapsed) {
+    double dt = elapsed - motion.start_sec;
+    return Ecef{
+        motion.start.x + motion.velocity_mps.x * dt,
+        motion.start.y + motion.velocity_mps.y * dt,
+        motion.start.z + motion.velocity_mps.z * dt,
+    };
+}
+
+/**
+ * @brief 経過時間が属する区間番号を二分探索で求めます。
+ *
+ * @details 時刻が巻き戻った場合など、前回の区間番号が使えないときのシーク用です。
+ *          戻り値は「区間終了時刻が経過時間より大きい最初の区間」で、std::upper_boundと同じ意味です。
+ */
+size_t seekSegmentCursor(const double *segment_end_secs, size_t segment_count, double elapsed);
+
+/**
+ * @brief 前回の区間番号から前方へ進めて、経過時間が属する区間番号を求めます。
+ *
+ * @details 時刻は通常前にしか進まないため、毎回二分探索する代わりに前回の位置から数歩だけ進めます。
+ *          経過時間が前回の区間より手前にある(時刻が巻き戻った)場合はseekSegmentCursorに切り替えます。
+ */
+size_t advanceSegmentCursor(const double *segment_end_secs,
+                            size_t segment_count,
+                            size_t cursor,
+                            double elapsed);
@@ -47,7 +47,7 @@ public:
      * @brief 近傍探索結果から探知・失探イベントを生成して出力します。
      */
     void updateDetection(int time_sec,
-                         const std::unordered_map<CellKey, std::vector<int>, CellKeyHash> &spatial_hash,
+                         const SpatialGrid &spatial_grid,
                          const std::vector<SimObject *> &objects,
                          int self_index);
 
@@ -33,6 +33,16 @@ public:
      * @brief 位置更新は派生クラスに委ね、固定・移動などの違いを動的ディスパッチで吸収します。
      */
     virtual void updatePosition(int time_sec) = 0;
+    /**
+     * @brief 時刻によって位置が変わる可能性があるかどうかを返します。
+     *
+     * @details falseのオブジェクトは毎秒の位置更新から外し、初期位置のまま扱います。
+     */
+    virtual bool isMovable() const = 0;
+    /**
+     * @brief 指定時刻までに移動を終え、以降は位置が変わらないかどうかを返します。
+     */
+    virtual bool hasArrived(int time_sec) const = 0;
 
     /**
      * @brief オブジェクト識別子を返します。
@@ -46,6 +56,10 @@ public:
      * @brief 役割を返します。
      */
     jsonobj::Role role() const { return m_role; }
+    /**
+     * @brief 移動開始時刻(秒)を返します。
+     */
+    int startSec() const { return m_start_sec; }
     /**
      * @brief 現在位置を返します。
      */
@@ -1,12 +1,17 @@
 #pragma once
 
-#include <memory>
 #include <string>
 #include <vector>
 
+#include "activation_scheduler.hpp"
+#include "attacker_object.hpp"
+#include "commander_object.hpp"
 #include "logging.hpp"
 #include "jsonobj/scenario.hpp"
+#include "messenger_object.hpp"
+#include "scout_object.hpp"
 #include "sim_object.hpp"
+#include "spatial_hash.hpp"
 
 /**
  * @brief シミュレーション全体の流れを管理するクラスです。
@@ -33,8 +38,12 @@ public:
 private:
     /**
      * @brief 具体的なオブジェクト生成は内部実装として隠蔽し、呼び出し側を単純にします。
+     *
+     * @details オブジェクトは1体ずつnewするのではなく、クラスごとの配列(プール)へまとめて並べます。
+     *          先に役割ごとの数を数えて配列の容量を確保するため、生成後に要素のアドレスが変わることはありません。
+     *          m_object_ptrsには、シナリオに書かれた順にプール内のオブジェクトを指すポインタを並べます。
      */
-    std::vector<std::unique_ptr<SimObject>> buildObjects(const jsonobj::Scenario &scenario);
+    void buildObjects(const jsonobj::Scenario &scenario);
     /**
      * @brief シナリオを読み込んで内部構造へ変換します。
      */
@@ -45,8 +54,28 @@ private:
      */
     bool m_initialized = false;
     jsonobj::Scenario m_scenario{};
-    std::vector<std::unique_ptr<SimObject>> m_objects{};
+    /**
+     * @brief クラスごとのオブジェクトのプールです。同じクラスのオブジェクトがメモリ上で連続して並びます。
+     *
+     * @details 探知は斥候のプール、爆破は攻撃役のプールだけを順に回せばよいため、
+     *          毎秒のdynamic_cast(実行時の型判定)で全オブジェクトを調べる必要がありません。
+     */
+    std::vector<CommanderObject> m_commanders{};
+    std::vector<ScoutObject> m_scouts{};
+    std::vector<MessengerObject> m_messengers{};
+    std::vector<AttackerObject> m_attackers{};
+    /**
+     * @brief 斥候のプールの各要素が、m_object_ptrsの何番目にあたるかです。探知で自分自身を除くために使います。
+     */
+    std::vector<int> m_scout_indices{};
+    /**
+     * @brief 全オブジェクトをシナリオの順に並べたビューです。実体は上のプールにあります。
+     *
+     * @details タイムライン出力や空間ハッシュなど、クラスによらず全員を扱う処理はこちらを使います。
+     */
     std::vector<SimObject *> m_object_ptrs{};
+    ActivationScheduler m_scheduler{};
+    SpatialGrid m_spatial_grid{};
     TimelineLogger m_timeline_logger{};
     EventLogger m_event_logger{};
     int m_end_sec = 24 * 60 * 60;
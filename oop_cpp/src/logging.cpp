@@ -54,15 +54,14 @@ void TimelineLogger::write(int time_sec, const std::vector<SimObject *> &objects
 
 void EventLogger::open(const std::string &path) {
     // イベントログの出力先を開き、非同期ロガーの初期化もここで行います。
-    if (!spdlog::thread_pool()) {
-        spdlog::init_thread_pool(8192, 1);
-    }
+    // スレッドプールはロガーごとに持ち、closeで確実に書き出しを終えられるようにします。
+    m_thread_pool = std::make_shared<spdlog::details::thread_pool>(8192, 1);
 
     auto sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(path, true);
     m_logger = std::make_shared<spdlog::async_logger>(
         "event_logger",
         sink,
-        spdlog::thread_pool(),
+        m_thread_pool,
         spdlog::async_overflow_policy::block);
 
     m_logger->set_level(spdlog::level::info);
@@ -84,8 +83,11 @@ void EventLogger::write(const nlohmann::json &event) {
 
 void EventLogger::close() {
     // テストや終了処理で明示的に閉じられるように用意します。
+    // スレッドプールを破棄するとキューに残ったログを書き終えるまで待つため、
+    // close後にファイルを読めば必ず全行がそろっています。
     if (m_logger) {
         m_logger->flush();
         m_logger.reset();
     }
+    m_thread_pool.reset();
 }
@@ -1,7 +1,6 @@
 #include "movable_object.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <utility>
 
 MovableObject::MovableObject(std::string id,
@@ -14,6 +13,7 @@ MovableObject::MovableObject(std::string id,
                              double total_duration_sec)
     : SimObject(std::move(id), std::move(team_id), role, start_sec, std::move(route), std::move(network)),
       m_segment_end_secs(std::move(segment_end_secs)),
+      m_segment_motions(buildSegmentMotions(m_route, m_segment_end_secs)),
       m_total_duration_sec(total_duration_sec) {}
 
 void MovableObject::updatePosition(int time_sec) {
@@ -49,31 +49,31 @@ void MovableObject::updatePosition(int time_sec) {
         return;
     }
 
-    auto it = std::upper_bound(m_segment_end_secs.begin(), m_segment_end_secs.end(), elapsed);
-    size_t segment_index = static_cast<size_t>(std::distance(m_segment_end_secs.begin(), it));
+    // 前回の区間番号を覚えておき、そこから前へ進めることで毎秒の二分探索を省きます。
+    // 時刻が巻き戻った場合はadvanceSegmentCursorの内部でシークに切り替わります。
+    m_segment_cursor = advanceSegmentCursor(
+        m_segment_end_secs.data(), m_segment_end_secs.size(), m_segment_cursor, elapsed);
+    size_t segment_index = m_segment_cursor;
     if (segment_index >= m_segment_end_secs.size()) {
         m_position = m_route.back().ecef;
         return;
     }
 
-    double segment_end = m_segment_end_secs[segment_index];
-    double segment_start = (segment_index == 0) ? 0.0 : m_segment_end_secs[segment_index - 1];
-    double segment_duration = segment_end - segment_start;
-    if (segment_duration <= 0.0) {
-        m_position = m_route[segment_index + 1].ecef;
-        return;
-    }
-    if (!std::isfinite(segment_duration)) {
-        m_position = m_route[segment_index].ecef;
-        return;
-    }
+    // 区間の始点と速度ベクトルは構築時に前計算してあるので、掛け算と足し算だけで位置が求まります。
+    // 速度0の区間や長さ0の区間も、速度0のレコードとして同じ式で扱えます。
+    m_position = segmentPosition(m_segment_motions[segment_index], elapsed);
+}
 
-    double t = (elapsed - segment_start) / segment_duration;
-    const Ecef &a = m_route[segment_index].ecef;
-    const Ecef &b = m_route[segment_index + 1].ecef;
-    m_position = Ecef{
-        a.x + (b.x - a.x) * t,
-        a.y + (b.y - a.y) * t,
-        a.z + (b.z - a.z) * t,
-    };
+bool MovableObject::isMovable() const {
+    // 司令官や経路の無いオブジェクトは、updatePositionを呼んでも位置が変わりません。
+    return m_role != jsonobj::Role::COMMANDER && !m_route.empty();
+}
+
+bool MovableObject::hasArrived(int time_sec) const {
+    // updatePositionで最後の経路点に固定される条件と同じ判定です。
+    if (m_segment_end_secs.empty()) {
+        return true;
+    }
+    double elapsed = static_cast<double>(time_sec - m_start_sec);
+    return elapsed >= m_total_duration_sec;
 }
@@ -31,7 +31,7 @@ ScoutObject::ScoutObject(std::string id,
 
 void ScoutObject::updateDetection(
     int time_sec,
-    const std::unordered_map<CellKey, std::vector<int>, CellKeyHash> &spatial_hash,
+    const SpatialGrid &spatial_grid,
     const std::vector<SimObject *> &objects,
     int self_index) {
     // 探知は斥候の責務としてまとめ、他の役割が関与しないようにします。
@@ -49,11 +49,7 @@ void ScoutObject::updateDetection(
         for (int dy = -1; dy <= 1; ++dy) {
             for (int dz = -1; dz <= 1; ++dz) {
                 CellKey key{base.x + dx, base.y + dy, base.z + dz};
-                auto it = spatial_hash.find(key);
-                if (it == spatial_hash.end()) {
-                    continue;
-                }
-                for (int index : it->second) {
+                for (int index : spatial_grid.cell(key)) {
                     if (index == self_index) {
                         continue;
                     }
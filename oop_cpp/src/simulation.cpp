@@ -31,11 +31,50 @@ std::string Simulation::roleToString(jsonobj::Role role) const
     return "unknown";
 }
 
-std::vector<std::unique_ptr<SimObject>> Simulation::buildObjects(const jsonobj::Scenario &scenario)
+void Simulation::buildObjects(const jsonobj::Scenario &scenario)
 {
-    // シナリオ定義を元に、役割に応じた派生クラスを生成します。
-    std::vector<std::unique_ptr<SimObject>> objects;
+    // 先に役割ごとの数を数え、各プールの容量をまとめて確保します。
+    // 容量が足りていれば配列の作り直しが起きないため、m_object_ptrsのポインタは最後まで有効です。
+    size_t commander_count = 0;
+    size_t scout_count = 0;
+    size_t messenger_count = 0;
+    size_t attacker_count = 0;
+    for (const auto &team : scenario.getTeams())
+    {
+        for (const auto &obj : team.getObjects())
+        {
+            switch (obj.getRole())
+            {
+            case jsonobj::Role::COMMANDER:
+                ++commander_count;
+                break;
+            case jsonobj::Role::SCOUT:
+                ++scout_count;
+                break;
+            case jsonobj::Role::MESSENGER:
+                ++messenger_count;
+                break;
+            case jsonobj::Role::ATTACKER:
+                ++attacker_count;
+                break;
+            }
+        }
+    }
 
+    m_object_ptrs.clear();
+    m_scout_indices.clear();
+    m_commanders.clear();
+    m_scouts.clear();
+    m_messengers.clear();
+    m_attackers.clear();
+    m_commanders.reserve(commander_count);
+    m_scouts.reserve(scout_count);
+    m_messengers.reserve(messenger_count);
+    m_attackers.reserve(attacker_count);
+    m_scout_indices.reserve(scout_count);
+    m_object_ptrs.reserve(commander_count + scout_count + messenger_count + attacker_count);
+
+    // シナリオ定義を元に、役割に応じた派生クラスをそれぞれのプールへ生成します。
     for (const auto &team : scenario.getTeams())
     {
         for (const auto &obj : team.getObjects())
@@ -56,11 +95,11 @@ std::vector<std::unique_ptr<SimObject>> Simulation::buildObjects(const jsonobj::
             switch (obj.getRole())
             {
             case jsonobj::Role::COMMANDER:
-                objects.push_back(std::make_unique<CommanderObject>(
-                    obj.getId(), team.getId(), obj.getRole(), start_sec, route, network));
+                m_commanders.emplace_back(obj.getId(), team.getId(), obj.getRole(), start_sec, route, network);
+                m_object_ptrs.push_back(&m_commanders.back());
                 break;
             case jsonobj::Role::SCOUT:
-                objects.push_back(std::make_unique<ScoutObject>(
+                m_scouts.emplace_back(
                     obj.getId(),
                     team.getId(),
                     start_sec,
@@ -70,10 +109,12 @@ std::vector<std::unique_ptr<SimObject>> Simulation::buildObjects(const jsonobj::
                     total_duration,
                     static_cast<int>(scenario.getPerformance().getScout().getDetectRangeM()),
                     static_cast<int>(scenario.getPerformance().getScout().getCommRangeM()),
-                    &m_event_logger));
+                    &m_event_logger);
+                m_scout_indices.push_back(static_cast<int>(m_object_ptrs.size()));
+                m_object_ptrs.push_back(&m_scouts.back());
                 break;
             case jsonobj::Role::MESSENGER:
-                objects.push_back(std::make_unique<MessengerObject>(
+                m_messengers.emplace_back(
                     obj.getId(),
                     team.getId(),
                     start_sec,
@@ -81,10 +122,11 @@ std::vector<std::unique_ptr<SimObject>> Simulation::buildObjects(const jsonobj::
                     network,
                     segment_ends,
                     total_duration,
-                    static_cast<int>(scenario.getPerformance().getMessenger().getCommRangeM())));
+                    static_cast<int>(scenario.getPerformance().getMessenger().getCommRangeM()));
+                m_object_ptrs.push_back(&m_messengers.back());
                 break;
             case jsonobj::Role::ATTACKER:
-                objects.push_back(std::make_unique<AttackerObject>(
+                m_attackers.emplace_back(
                     obj.getId(),
                     team.getId(),
                     start_sec,
@@ -93,13 +135,12 @@ std::vector<std::unique_ptr<SimObject>> Simulation::buildObjects(const jsonobj::
                     segment_ends,
                     total_duration,
                     static_cast<int>(scenario.getPerformance().getAttacker().getBomRangeM()),
-                    &m_event_logger));
+                    &m_event_logger);
+                m_object_ptrs.push_back(&m_attackers.back());
                 break;
             }
         }
     }
-
-    return objects;
 }
 
 jsonobj::Scenario Simulation::loadScenario(const std::string &path) const
@@ -127,13 +168,17 @@ void Simulation::initialize(const std::string &scenario_path,
     m_event_logger.open(event_path);
     m_timeline_logger.open(timeline_path);
     m_scenario = loadScenario(scenario_path);
-    m_objects = buildObjects(m_scenario);
+    buildObjects(m_scenario);
 
-    m_object_ptrs.clear();
-    m_object_ptrs.reserve(m_objects.size());
-    for (const auto &obj : m_objects)
+    // 位置が変わる可能性のあるオブジェクトだけをスケジューラへ登録します。
+    // 司令官などの固定オブジェクトは初期位置のままなので、毎秒の更新から外れます。
+    m_scheduler.clear();
+    for (size_t i = 0; i < m_object_ptrs.size(); ++i)
     {
-        m_object_ptrs.push_back(obj.get());
+        if (m_object_ptrs[i]->isMovable())
+        {
+            m_scheduler.add(i, m_object_ptrs[i]->startSec());
+        }
     }
 
     m_end_sec = 24 * 60 * 60;
@@ -149,32 +194,31 @@ void Simulation::run()
     }
 
     // 1秒刻みで、位置更新→探知→爆破→ログ出力の順に処理します。
+    m_scheduler.rewind();
     for (int time_sec = 0; time_sec <= m_end_sec; ++time_sec)
     {
-        for (auto &obj : m_objects)
+        // 開始時刻を迎えて移動中になったオブジェクトだけ位置を更新します。
+        // 開始前・移動完了後のオブジェクトは位置が変わらないので、前回の位置をそのまま使います。
+        m_scheduler.activate(time_sec);
+        for (size_t index : m_scheduler.active())
         {
-            obj->updatePosition(time_sec);
+            m_object_ptrs[index]->updatePosition(time_sec);
         }
+        m_scheduler.retireIf([&](size_t index) { return m_object_ptrs[index]->hasArrived(time_sec); });
 
-        std::unordered_map<CellKey, std::vector<int>, CellKeyHash> spatial_hash =
-            buildSpatialHash(m_object_ptrs, m_detect_range);
+        // 空間格子は毎秒作り直しますが、配列は使い回すので2秒目以降はヒープ確保が起きません。
+        m_spatial_grid.build(m_object_ptrs, m_detect_range);
 
-        for (size_t i = 0; i < m_objects.size(); ++i)
+        // 探知は斥候のプール、爆破は攻撃役のプールだけを順に回します。
+        // プールはシナリオの順に並んでいるため、イベントの出力順も全オブジェクトを調べていたときと変わりません。
+        for (size_t i = 0; i < m_scouts.size(); ++i)
         {
-            auto *scout = dynamic_cast<ScoutObject *>(m_objects[i].get());
-            if (scout)
-            {
-                scout->updateDetection(time_sec, spatial_hash, m_object_ptrs, static_cast<int>(i));
-            }
+            m_scouts[i].updateDetection(time_sec, m_spatial_grid, m_object_ptrs, m_scout_indices[i]);
         }
 
-        for (auto &obj : m_objects)
+        for (auto &attacker : m_attackers)
         {
-            auto *attacker = dynamic_cast<AttackerObject *>(obj.get());
-            if (attacker)
-            {
-                attacker->emitDetonation(time_sec);
-            }
+            attacker.emitDetonation(time_sec);
         }
 
         m_timeline_logger.write(time_sec, m_object_ptrs, *this);
@@ -0,0 +1,45 @@
+#include "catch_amalgamated.hpp"
+
+#include <vector>
+
+#include "activation_scheduler.hpp"
+
+TEST_CASE("ActivationSchedulerは開始時刻を迎えたものを添字順に移動中リストへ加えること", "[activation_scheduler]") {
+    // 登録順や開始時刻の順に関係なく、移動中リストは添字の昇順に並ぶことを確認します。
+    ActivationScheduler scheduler;
+    scheduler.add(4, 10);
+    scheduler.add(1, 0);
+    scheduler.add(3, 5);
+    scheduler.add(0, 10);
+    scheduler.rewind();
+
+    scheduler.activate(0);
+    REQUIRE(scheduler.active() == std::vector<size_t>{1});
+
+    scheduler.activate(9);
+    REQUIRE(scheduler.active() == std::vector<size_t>{1, 3});
+
+    scheduler.activate(10);
+    REQUIRE(scheduler.active() == std::vector<size_t>{0, 1, 3, 4});
+}
+
+TEST_CASE("ActivationSchedulerは移動を終えたものをリストから外し、rewindで最初に戻ること", "[activation_scheduler]") {
+    ActivationScheduler scheduler;
+    scheduler.add(0, 0);
+    scheduler.add(1, 0);
+    scheduler.add(2, 3);
+    scheduler.rewind();
+
+    scheduler.activate(0);
+    scheduler.retireIf([](size_t index) { return index == 1; });
+    REQUIRE(scheduler.active() == std::vector<size_t>{0});
+
+    scheduler.activate(3);
+    REQUIRE(scheduler.active() == std::vector<size_t>{0, 2});
+
+    // 巻き戻すと、外したものも含めて開始時刻から登録し直されます。
+    scheduler.rewind();
+    REQUIRE(scheduler.active().empty());
+    scheduler.activate(0);
+    REQUIRE(scheduler.active() == std::vector<size_t>{0, 1});
+}
@@ -27,14 +27,15 @@ TEST_CASE("AttackerObjectは到達後に一度だけ爆破ログを出力する
     obj.emitDetonation(1);
     obj.emitDetonation(2);
 
+    // 非同期ロガーの書き出しを待ってから読み込みます。
+    logger.close();
+
     std::ifstream in(path);
     std::string line1;
     std::string line2;
     std::getline(in, line1);
     std::getline(in, line2);
 
-    logger.close();
-
     REQUIRE_FALSE(line1.empty());
     REQUIRE(line2.empty());
 }
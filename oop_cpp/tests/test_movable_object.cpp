@@ -20,3 +20,45 @@ TEST_CASE("MovableObjectは開始前と完了後で位置が固定されるこ
     obj.updatePosition(6);
     REQUIRE(obj.position().x == Catch::Approx(10.0));
 }
+
+TEST_CASE("MovableObjectは時刻を巻き戻しても正しい区間で補間されること", "[movable_object]") {
+    // 区間カーソルは前に進める前提ですが、時刻が戻った場合もシークで正しい区間に戻ることを確認します。
+    RoutePoint a;
+    a.ecef = Ecef{0.0, 0.0, 0.0};
+    RoutePoint b;
+    b.ecef = Ecef{10.0, 0.0, 0.0};
+    RoutePoint c;
+    c.ecef = Ecef{10.0, 20.0, 0.0};
+
+    std::vector<RoutePoint> route{a, b, c};
+    std::vector<double> segment_end_secs{10.0, 20.0};
+
+    MovableObject obj("move-2", "team-a", jsonobj::Role::MESSENGER, 0, route, {}, segment_end_secs, 20.0);
+
+    obj.updatePosition(15);
+    REQUIRE(obj.position().x == Catch::Approx(10.0));
+    REQUIRE(obj.position().y == Catch::Approx(10.0));
+
+    obj.updatePosition(5);
+    REQUIRE(obj.position().x == Catch::Approx(5.0));
+    REQUIRE(obj.position().y == Catch::Approx(0.0));
+}
+
+TEST_CASE("MovableObjectは移動の可否と到着を正しく判定すること", "[movable_object]") {
+    // スケジューラが位置更新から外してよいかどうかを、この2つの判定で決めます。
+    RoutePoint a;
+    a.ecef = Ecef{0.0, 0.0, 0.0};
+    RoutePoint b;
+    b.ecef = Ecef{10.0, 0.0, 0.0};
+
+    std::vector<RoutePoint> route{a, b};
+    std::vector<double> segment_end_secs{10.0};
+
+    MovableObject obj("move-3", "team-a", jsonobj::Role::MESSENGER, 5, route, {}, segment_end_secs, 10.0);
+    REQUIRE(obj.isMovable());
+    REQUIRE_FALSE(obj.hasArrived(14));
+    REQUIRE(obj.hasArrived(15));
+
+    MovableObject no_route("move-4", "team-a", jsonobj::Role::MESSENGER, 0, {}, {}, {}, 0.0);
+    REQUIRE_FALSE(no_route.isMovable());
+}
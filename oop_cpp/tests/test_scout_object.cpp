@@ -23,17 +23,19 @@ TEST_CASE("ScoutObjectは敵が範囲内に入ると探知イベントを出力
     CommanderObject enemy("enemy-1", "team-b", jsonobj::Role::COMMANDER, 0, enemy_route, {});
 
     std::vector<SimObject *> objects{&scout, &enemy};
-    auto spatial_hash = buildSpatialHash(objects, 100.0);
+    SpatialGrid spatial_grid;
+    spatial_grid.build(objects, 100.0);
 
     auto path = std::filesystem::temp_directory_path() / "sim_compare_scout_event.log";
     logger.open(path.string());
 
-    scout.updateDetection(0, spatial_hash, objects, 0);
+    scout.updateDetection(0, spatial_grid, objects, 0);
+
+    // 非同期ロガーの書き出しを待ってから読み込みます。
+    logger.close();
 
     std::ifstream in(path);
     std::string log;
     std::getline(in, log);
-
-    logger.close();
     REQUIRE(log.find("\"detection_action\":\"found\"") != std::string::npos);
 }
@@ -1,5 +1,8 @@
 #include "catch_amalgamated.hpp"
 
+#include <limits>
+#include <vector>
+
 #include "geo.hpp"
 #include "route.hpp"
 #include "simulation.hpp"
@@ -45,6 +48,49 @@ TEST_CASE("移動区間時間の計算が速度に一致すること", "[route]"
     REQUIRE(result.second == Catch::Approx(1.0).margin(1e-6));
 }
 
+TEST_CASE("区間カーソルの前進が二分探索と同じ区間を返すこと", "[route]") {
+    // 前回の区間から進める方法と、毎回二分探索する方法で結果が一致することを確認します。
+    std::vector<double> segment_end_secs{2.0, 2.0, 5.0, 9.0};
+    size_t cursor = 0;
+    for (int t = 0; t <= 10; ++t) {
+        double elapsed = static_cast<double>(t);
+        cursor = advanceSegmentCursor(segment_end_secs.data(), segment_end_secs.size(), cursor, elapsed);
+        REQUIRE(cursor == seekSegmentCursor(segment_end_secs.data(), segment_end_secs.size(), elapsed));
+    }
+
+    // 時刻が巻き戻った場合もシークで正しい区間に戻ります。
+    cursor = advanceSegmentCursor(segment_end_secs.data(), segment_end_secs.size(), cursor, 3.0);
+    REQUIRE(cursor == 2);
+}
+
+TEST_CASE("区間の移動レコードが始点・速度・開始時刻を正しく持つこと", "[route]") {
+    // 通常の区間・長さ0の区間・速度0の区間が、それぞれ想定した位置になることを確認します。
+    std::vector<RoutePoint> route(4);
+    route[0].ecef = Ecef{0.0, 0.0, 0.0};
+    route[1].ecef = Ecef{100.0, 0.0, 0.0};
+    route[2].ecef = Ecef{100.0, 0.0, 0.0};
+    route[3].ecef = Ecef{100.0, 50.0, 0.0};
+    std::vector<double> segment_end_secs{10.0, 10.0, std::numeric_limits<double>::infinity()};
+
+    std::vector<SegmentMotion> motions = buildSegmentMotions(route, segment_end_secs);
+    REQUIRE(motions.size() == 3);
+
+    REQUIRE(motions[0].start_sec == 0.0);
+    REQUIRE(motions[0].velocity_mps.x == Catch::Approx(10.0));
+    Ecef middle = segmentPosition(motions[0], 4.0);
+    REQUIRE(middle.x == Catch::Approx(40.0));
+    REQUIRE(middle.y == Catch::Approx(0.0));
+
+    // 長さ0の区間は終点に留まります。
+    REQUIRE(motions[1].velocity_mps.x == 0.0);
+    REQUIRE(segmentPosition(motions[1], 10.0).x == Catch::Approx(100.0));
+
+    // 速度0の区間(所要時間が無限大)は始点に留まります。
+    Ecef waiting = segmentPosition(motions[2], 500.0);
+    REQUIRE(waiting.x == Catch::Approx(100.0));
+    REQUIRE(waiting.y == Catch::Approx(0.0));
+}
+
 TEST_CASE("役割の文字列化が期待通りであること", "[simulation]") {
     // ログ出力で使う役割文字列が変わらないことを確認します。
     Simulation simulation;
@@ -0,0 +1,61 @@
+#include "catch_amalgamated.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "fixed_object.hpp"
+#include "geo.hpp"
+#include "route.hpp"
+#include "spatial_hash.hpp"
+
+namespace {
+
+std::unique_ptr<FixedObject> makeObject(int number, const Ecef &pos) {
+    RoutePoint point;
+    point.ecef = pos;
+    auto obj = std::make_unique<FixedObject>("obj-" + std::to_string(number), "team-a", jsonobj::Role::COMMANDER, 0,
+                                             std::vector<RoutePoint>{point}, std::vector<std::string>{});
+    obj->updatePosition(0);
+    return obj;
+}
+
+} // namespace
+
+TEST_CASE("SpatialGridは各セルのオブジェクト番号を昇順にまとめること", "[spatial_hash]") {
+    // 負の座標や離れたセルも混ぜ、セル座標ごとの一覧が総当たりで求めたものと一致することを確かめます。
+    std::vector<std::unique_ptr<FixedObject>> owned;
+    std::vector<SimObject *> objects;
+    for (int i = 0; i < 200; ++i) {
+        double x = static_cast<double>((i * 37) % 23 - 11) * 45.0;
+        double y = static_cast<double>((i * 11) % 7 - 3) * 130.0;
+        double z = i % 5 == 0 ? 1.0e6 : -20.0;
+        owned.push_back(makeObject(i, Ecef{x, y, z}));
+        objects.push_back(owned.back().get());
+    }
+
+    SpatialGrid grid;
+    // 2回作り直し、使い回した表に前回の中身が残らないことも確かめます。
+    for (double cell_size : {100.0, 250.0}) {
+        grid.build(objects, cell_size);
+        for (size_t i = 0; i < objects.size(); ++i) {
+            CellKey key = cellKey(objects[i]->position(), cell_size);
+            std::vector<int> expected;
+            for (size_t j = 0; j < objects.size(); ++j) {
+                if (cellKey(objects[j]->position(), cell_size) == key) {
+                    expected.push_back(static_cast<int>(j));
+                }
+            }
+            SpatialGrid::CellRange range = grid.cell(key);
+            std::vector<int> actual(range.begin(), range.end());
+            REQUIRE(actual == expected);
+        }
+        // 誰もいないセルは空の範囲になります。
+        SpatialGrid::CellRange empty = grid.cell(CellKey{1000000, 1000000, 1000000});
+        REQUIRE(empty.begin() == empty.end());
+    }
+
+    // セルサイズが0以下なら、どのセルも空です。
+    grid.build(objects, 0.0);
+    SpatialGrid::CellRange none = grid.cell(cellKey(objects[0]->position(), 100.0));
+    REQUIRE(none.begin() == none.end());
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "soa_storage.hpp"
+
+/**
+ * @brief 局所座標系の接平面(東・北)上の軸に平行な長方形(AABB)です。単位はメートルです。
+ */
+struct PlaneBox {
+    double min_e = 0.0;
+    double min_n = 0.0;
+    double max_e = 0.0;
+    double max_n = 0.0;
+};
+
+/**
+ * @brief 接平面上の1点です。
+ */
+struct PlanePoint {
+    double e = 0.0;
+    double n = 0.0;
+};
+
+/**
+ * @brief storageの座標系に合わせて、index番目のオブジェクトを接平面(東・北)上の点へ射影します。
+ *
+ * @details 平面への直交投影では2点の間隔が伸びることはないため、探知距離以内の相手は平面上でも探知距離以内にいます。
+ */
+PlanePoint planePoint(const SoaStorage &storage, size_t index);
+
+/**
+ * @brief オブジェクトを囲む長方形を木構造(BVH)にまとめ、位置が変わっても作り直さずに保つ動的AABB木です。
+ *
+ * @details 葉はオブジェクト1体分で、位置の周りにmarginだけ広げた「太らせた」長方形を持ちます。
+ *          内側の節は2つの子をまとめて囲む長方形を持ち、斥候の探知範囲と重ならない節は子ごと読み飛ばします。
+ *          密集した場所では木が深く細かく分かれ、まばらな場所では浅いままなので、
+ *          格子のように「セル1つの中身が多すぎる」「空のセルばかり調べる」ということが起きません。
+ *
+ *          毎秒の更新では、動いたオブジェクトが太らせた長方形の中に留まっている限り何もしません。
+ *          はみ出したものだけ葉を外して新しい位置で入れ直し(再挿入)、通った節の長方形を囲み直します(refit)。
+ *          入れ直すときは囲む長方形の周長の増え方が小さい場所を選び、木の左右の高さの差が2以上になったら回転して釣り合いを取ります。
+ *          節は配列に置き、外した節は空きリストで使い回すため、buildの後はヒープ確保が起きません。
+ */
+class DynamicAabbTree {
+public:
+    /**
+     * @brief 全オブジェクトを1体ずつ挿入して木を作り直します。initializeと、オブジェクトの並べ替えの後に呼びます。
+     *
+     * @details marginは葉の長方形を位置の周りに広げる幅です。大きいほど再挿入は減りますが、探索で拾う候補は増えます。
+     */
+    void build(const SoaStorage &storage, double margin);
+    /**
+     * @brief indicesに挙げたオブジェクトの位置を読み直し、太らせた長方形からはみ出したものだけ入れ直します。
+     *
+     * @details 位置を書き換えたオブジェクト(移動中リスト)だけを渡します。
+     */
+    void update(const SoaStorage &storage, const size_t *indices, size_t count);
+    /**
+     * @brief index番目のオブジェクトから平面上で東西・南北ともrange以内の長方形と重なる葉の、ほかのオブジェクトの番号をfn(other)で受け取ります。
+     *
+     * @details 葉の長方形はオブジェクトの位置を含むため、平面上でrange以内にいる相手は必ず受け取れます(少し遠い相手も混ざります)。
+     *          受け取る順番は決まっていないため、使う側は順番に依存しないようにしてください。
+     */
+    template <typename Fn>
+    void forEachNear(size_t index, double range, Fn fn) const {
+        if (m_root == -1) {
+            return;
+        }
+        const PlanePoint &center = m_points[index];
+        PlaneBox query{center.e - range, center.n - range, center.e + range, center.n + range};
+        // 再帰の代わりに作業用の配列を積み木のように使います。容量は残るため、2回目以降はヒープ確保が起きません。
+        std::vector<int> &stack = m_stack;
+        stack.clear();
+        stack.push_back(m_root);
+        while (!stack.empty()) {
+            int node_index = stack.back();
+            stack.pop_back();
+            const Node &node = m_nodes[static_cast<size_t>(node_index)];
+            if (!overlaps(node.box, query)) {
+                continue;
+            }
+            if (node.isLeaf()) {
+                if (static_cast<size_t>(node.object) != index) {
+                    fn(static_cast<size_t>(node.object));
+                }
+                continue;
+            }
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+    /**
+     * @brief 直前のupdateで太らせた長方形からはみ出し、入れ直したオブジェクトの数です。計測や検証に使います。
+     */
+    size_t lastReinsertCount() const { return m_last_reinserts; }
+    /**
+     * @brief 木の高さ(根から最も深い葉までの節の数 - 1)です。葉が1つなら0、空なら-1です。
+     */
+    int height() const { return m_root == -1 ? -1 : m_nodes[static_cast<size_t>(m_root)].height; }
+    /**
+     * @brief 木がstorageの現在位置と一致しているかを総当たりで確かめます。
+     *
+     * @details すべてのオブジェクトが1回ずつ葉になっていて葉の長方形が今の位置を含むこと、
+     *          各節の長方形と高さが子から求めた値と同じで、親子のつながりが正しいことを調べ、
+     *          食い違いがあればstd::runtime_errorを投げます。検証モード(SOA_SPATIAL_CHECK=1)でだけ使います。
+     */
+    void verify(const SoaStorage &storage) const;
+
+private:
+    /**
+     * @brief 木の節です。child1が-1なら葉で、objectがオブジェクトの番号です。
+     *
+     * @details 空きリストに入っている節は、parentを次の空き節の番号として使います。
+     */
+    struct Node {
+        PlaneBox box{};
+        int parent = -1;
+        int child1 = -1;
+        int child2 = -1;
+        int height = 0;
+        int object = -1;
+
+        bool isLeaf() const { return child1 == -1; }
+    };
+
+    static bool overlaps(const PlaneBox &a, const PlaneBox &b) {
+        return a.min_e <= b.max_e && b.min_e <= a.max_e && a.min_n <= b.max_n && b.min_n <= a.max_n;
+    }
+
+    int allocateNode();
+    void freeNode(int node_index);
+    /**
+     * @brief 葉を木へ入れ、根までの節の長方形と高さを直します。
+     */
+    void insertLeaf(int leaf);
+    /**
+     * @brief 葉を木から外します。葉の節自体は残し、兄弟と置き換わる親の節を空きリストへ戻します。
+     */
+    void removeLeaf(int leaf);
+    /**
+     * @brief 節から根まで上りながら、回転で釣り合いを取り、長方形と高さを子から求め直します。
+     */
+    void refitUpward(int node_index);
+    /**
+     * @brief 左右の子の高さの差が2以上なら回転し、その位置に来た節の番号を返します。
+     */
+    int balance(int node_index);
+    /**
+     * @brief 葉の長方形を、位置の周りにm_marginだけ広げた長方形にします。
+     */
+    PlaneBox fattenedBox(const PlanePoint &point) const;
+
+    std::vector<Node> m_nodes{};
+    /**
+     * @brief オブジェクトごとの葉の節の番号と、最後に読んだ接平面上の位置です。
+     */
+    std::vector<int> m_leaves{};
+    std::vector<PlanePoint> m_points{};
+    mutable std::vector<int> m_stack{};
+    int m_root = -1;
+    int m_free = -1;
+    double m_margin = 0.0;
+    size_t m_last_reinserts = 0;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+/**
+ * @brief 探知の近傍探索(ブロードフェーズ)にどの方式を使うかを表す列挙型です。
+ *
+ * @details GRIDは探知距離の幅の正方形セルに区切る空間格子で、標準の方式です。
+ *          SWEEP_AND_PRUNEは全オブジェクトを1本の軸の座標順に並べておき、軸上で探知距離以内にいる相手だけを調べる方式です。
+ *          経路沿いの船団のようにオブジェクトが少数のセルに固まるシナリオでは、格子ではセル1つの中身が大きくなりすぎるため、
+ *          こちらで比べられるようにしています。
+ *          DYNAMIC_BVHはオブジェクトを囲む箱を木構造にまとめる方式で、港の入口のような狭い範囲に大半が集まり、
+ *          ほかはまばらという密度の偏りが大きいシナリオに向いています。
+ *          どの方式でも探知・失探イベントは同じです。
+ */
+enum class Broadphase {
+    GRID,
+    SWEEP_AND_PRUNE,
+    DYNAMIC_BVH,
+};
+
+/**
+ * @brief 環境変数SOA_BROADPHASE(grid/sap/bvh)から近傍探索の方式を選びます。
+ *
+ * @details 未指定や不明な値のときはGRIDです。計測や結果比較のための切り替え口です。
+ */
+Broadphase selectBroadphase();
+
+/**
+ * @brief 近傍探索の方式をログや計測結果に出すための文字列へ変換します。
+ */
+const char *broadphaseName(Broadphase broadphase);
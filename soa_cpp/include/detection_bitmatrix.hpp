@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "geo.hpp"
+
+/**
+ * @brief 斥候ごとの探知状態をどの方式で持つかを表す列挙型です。
+ *
+ * @details SORTED_VECTORは探知中の相手のハンドルを昇順の配列で持つ標準の方式です。
+ *          BITMATRIXは(斥候, 相手)の組ごとに1bitを持つビット行列で、前の秒と今の秒のビットの差から
+ *          探知・失探を求めます。斥候が多く、探知状態がほとんど変わらない秒が続く場合に向いています。
+ *          どちらの方式でも出力されるログは同じです。
+ */
+enum class DetectionBackend {
+    SORTED_VECTOR,
+    BITMATRIX,
+};
+
+/**
+ * @brief 環境変数SOA_DETECTION_STATE(sorted/bitmatrix)から探知状態の方式を選びます。
+ *
+ * @details 未指定や不明な値のときはSORTED_VECTORです。計測や結果比較のための切り替え口です。
+ */
+DetectionBackend selectDetectionBackend();
+
+/**
+ * @brief 探知状態の方式をログや計測結果に出すための文字列へ変換します。
+ */
+const char *detectionBackendName(DetectionBackend backend);
+
+/**
+ * @brief 探知した相手1体分の情報です。ビット行列の1bitと、整列済み配列の探知状態の1件に対応します。
+ *
+ * @details 緯度経度は探知・失探イベントを書き出すときにだけ求めればよいため、ここではECEFの位置のまま持ちます。
+ *          同じ位置からは常に同じ緯度経度が求まるので、毎秒変換していたときと出力は変わりません。
+ */
+struct ContactPayload {
+    Ecef position{0.0, 0.0, 0.0};
+    int distance_m = 0;
+};
+
+/**
+ * @brief 斥候×相手の探知状態を、前の秒と今の秒の2枚のビット行列で持つクラスです。
+ *
+ * @details 行は斥候(オブジェクトの添字)、列は相手のオブジェクトハンドルです。
+ *          行全体を確保すると「斥候数×オブジェクト数」のメモリが要るため、列を64個ずつのブロックに区切り、
+ *          今の秒か前の秒に探知した相手を含むブロックだけを持ちます(疎なブロック構成)。
+ *          探知情報(ContactPayload)もブロックに64個分を並べて持つのではなく、立っているビットの分だけを詰めて持ちます。
+ *          メモリは同時に探知している組の数に比例し、オブジェクト数が増えても行列全体の大きさにはなりません。
+ *          探知は「今だけ1」(curr & ~prev)、失探は「前だけ1」(prev & ~curr)で、64組ずつまとめて判定できます。
+ *
+ *          1行分の使い方は次のとおりです。
+ *          1. beginRowで今の秒のビットを前の秒へ移し、今の秒を0にします。
+ *          2. 今の秒に探知した相手ごとにsetを呼びます。
+ *          3. forEachChangeで探知・失探した相手をハンドルの昇順に受け取ります。
+ *          4. endRowで、どちらの秒にも探知がなくなったブロックを捨てます。
+ */
+class DetectionBitmatrix {
+public:
+    /**
+     * @brief 行数(オブジェクト数)を設定し、すべての探知状態を消します。
+     */
+    void reset(size_t row_count);
+    /**
+     * @brief 行をorderの並び(order[新しい行] = 今の行)に入れ替えます。行を使っていないとき(0行)は何もしません。
+     *
+     * @details 列は相手のハンドルなので、オブジェクトを並べ替えても書き換える必要はありません。
+     */
+    void permuteRows(const std::vector<uint32_t> &order);
+    /**
+     * @brief 指定した行の今の秒のビットを前の秒へ移し、今の秒を0にします。
+     */
+    void beginRow(size_t row);
+    /**
+     * @brief 指定した行で、今の秒にtargetを探知したことを記録します。
+     *
+     * @details 同じ秒に同じtargetを2回記録したときは最初の情報を残し、falseを返します。
+     *          新しいブロックが要るときだけ行の配列へ追加します。容量は残るため、定常状態ではヒープ確保が起きません。
+     */
+    bool set(size_t row, uint32_t target, const ContactPayload &payload);
+    /**
+     * @brief 指定した行で探知・失探した相手を、ハンドルの昇順にfn(target, found, payload)で受け取ります。
+     *
+     * @details foundがtrueなら探知(今の秒の情報)、falseなら失探(最後に探知した秒の情報)です。
+     *          変化のない64組は1回の比較で読み飛ばせるため、探知状態が変わらない秒はほとんど時間がかかりません。
+     */
+    template <typename Fn>
+    void forEachChange(size_t row, Fn fn) const {
+        for (const Block &block : m_rows[row]) {
+            uint64_t found = block.curr & ~block.prev;
+            uint64_t changed = found | (block.prev & ~block.curr);
+            while (changed != 0) {
+                // 最下位の1のビット位置(ctz)から順に取り出すと、ハンドルの昇順になります。
+                int bit = __builtin_ctzll(changed);
+                changed &= changed - 1;
+                uint32_t target = block.word * 64u + static_cast<uint32_t>(bit);
+                if (((found >> bit) & 1u) != 0) {
+                    fn(target, true, block.curr_payloads[rankBelow(block.curr, bit)]);
+                } else {
+                    fn(target, false, block.prev_payloads[rankBelow(block.prev, bit)]);
+                }
+            }
+        }
+    }
+    /**
+     * @brief 指定した行で今の秒に探知している相手を、ハンドルの昇順にfn(target)で受け取ります。
+     *
+     * @details 整列済み配列の方式のtargetsと同じ並びになるため、2つの方式の探知状態をそのまま比べられます。
+     */
+    template <typename Fn>
+    void forEachTarget(size_t row, Fn fn) const {
+        for (const Block &block : m_rows[row]) {
+            uint64_t bits = block.curr;
+            while (bits != 0) {
+                int bit = __builtin_ctzll(bits);
+                bits &= bits - 1;
+                fn(block.word * 64u + static_cast<uint32_t>(bit));
+            }
+        }
+    }
+    /**
+     * @brief 指定した行から、今の秒に1bitも立っていないブロックを捨てます。
+     *
+     * @details 次の秒では前の秒のビットも0になるため、このブロックを残しておく必要がありません。
+     */
+    void endRow(size_t row);
+    /**
+     * @brief 指定した行で、今の秒にtargetを探知しているかどうかを返します。
+     */
+    bool contains(size_t row, uint32_t target) const;
+    /**
+     * @brief すべての行が持っているブロックの合計数です。メモリ使用量の目安になります。
+     */
+    size_t blockCount() const;
+    /**
+     * @brief すべての行が持っている探知情報の合計数です。前の秒と今の秒に立っているビットの数と同じになります。
+     */
+    size_t payloadCount() const;
+
+private:
+    /**
+     * @brief 64組分のビットと探知情報をまとめたブロックです。wordは「ハンドル / 64」の値です。
+     *
+     * @details 探知情報は立っているビットの分だけを、ビット位置の昇順に詰めた配列で持ちます。
+     *          ビット位置bitの情報は、それより下に立っているビットの数(rankBelow)番目にあります。
+     *          前の秒の情報は失探のときに使うため、前の秒と今の秒の2本を持ち、beginRowで入れ替えます。
+     *          入れ替えても両方の容量は残るため、探知している相手が変わらない秒ではヒープ確保が起きません。
+     */
+    struct Block {
+        uint32_t word = 0;
+        uint64_t prev = 0;
+        uint64_t curr = 0;
+        std::vector<ContactPayload> prev_payloads{};
+        std::vector<ContactPayload> curr_payloads{};
+    };
+
+    /**
+     * @brief bitsのうち、ビット位置bitより下に立っているビットの数です。詰めた探知情報の配列の添字になります。
+     */
+    static size_t rankBelow(uint64_t bits, int bit) {
+        return static_cast<size_t>(__builtin_popcountll(bits & ((uint64_t{1} << bit) - 1u)));
+    }
+
+    /**
+     * @brief 行ごとのブロックの配列です。各行の配列はwordの昇順に並べます。
+     */
+    std::vector<std::vector<Block>> m_rows{};
+};
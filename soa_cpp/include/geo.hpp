@@ -21,7 +21,50 @@ double distanceEcef(const Ecef &a, const Ecef &b);
  */
 Ecef geodeticToEcef(double lat_deg, double lon_deg, double alt_m);
 
+/**
+ * @brief ECEFから緯度経度高度へ変換するときの計算方法(精度と速さの段階)を表す列挙型です。
+ *
+ * @details ITERATIVEは緯度を5回の反復で詰める従来の方法で、標準です。三角関数などを20回ほど呼ぶため最も遅く、
+ *          ほかの実装(aos_cppなど)と出力をビット単位でそろえたいときはこれを使います。
+ *          BOWRINGはBowringの式を1回だけ当てはめる方法です。atan2を2回と平方根を数回呼ぶだけで、
+ *          地表付近(高度-1km〜50km程度)では反復法との差が0.1mm未満に収まります。
+ *          VERMEILLEはVermeille(2004)の閉じた式で、反復も近似もなく、丸め誤差の範囲で厳密な値が求まります。
+ *          立方根と平方根が多いぶんBOWRINGより少し遅く、地球の中心付近(半径数十km以内)では使えません。
+ */
+enum class GeodeticMethod {
+    ITERATIVE,
+    BOWRING,
+    VERMEILLE,
+};
+
+/**
+ * @brief 環境変数SOA_GEODETIC(iterative/bowring/vermeille)から変換方法を選びます。
+ *
+ * @details 未指定や不明な値のときはITERATIVEです。計測や精度比較のための切り替え口です。
+ */
+GeodeticMethod selectGeodeticMethod();
+
+/**
+ * @brief 変換方法をログや計測結果に出すための文字列へ変換します。
+ */
+const char *geodeticMethodName(GeodeticMethod method);
+
+/**
+ * @brief 方法を指定しないecefToGeodeticが使う変換方法です。
+ *
+ * @details 最初に呼んだときselectGeodeticMethodで1回だけ決め、以降はずっと同じ方法を返します。
+ *          まとめて変換する関数(geodetic_batch.hpp)に同じ方法を渡すときに使います。
+ */
+GeodeticMethod activeGeodeticMethod();
+
 /**
  * @brief ECEF座標を緯度経度高度へ変換します。
+ *
+ * @details 計算方法はactiveGeodeticMethodで決まります。
  */
 void ecefToGeodetic(const Ecef &pos, double &lat_deg, double &lon_deg, double &alt_m);
+
+/**
+ * @brief 計算方法を指定して、ECEF座標を緯度経度高度へ変換します。精度の比較や計測で使います。
+ */
+void ecefToGeodetic(GeodeticMethod method, const Ecef &pos, double &lat_deg, double &lon_deg, double &alt_m);
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+
+#include "geo.hpp"
+#include "position_kernel.hpp"
+
+/**
+ * @brief ECEF座標の配列(x[], y[], z[])をまとめて緯度経度高度の配列(lat[], lon[], alt[])へ変換します。
+ *
+ * @details 配列はSoA形式で、添字ごとに1点です。出力先は入力と同じ長さを確保しておいてください。
+ *          methodがBOWRINGでisaがAVX2以上のときは、atan2と平方根をSIMD命令(doubleを4個同時)で計算します。
+ *          atan2はlibmを呼ばず、範囲を[0, 1]へ畳んでから多項式の比で近似する方法(Cephesと同じ係数)で求めます。
+ *          誤差は最後の桁(1e-16程度)なので、スカラー版のBOWRINGとの差は緯度で1e-13度未満、高度は同じ値です。
+ *          4点に満たない端数と、地球の中心のような扱いにくい点はスカラー版で計算します。
+ *          ITERATIVEとVERMEILLEは1点ずつスカラー版を呼ぶため、ecefToGeodetic(method, ...)とビット単位で同じ結果です。
+ *          AVX-512のCPUでも、この変換はAVX2版を使います。
+ */
+void ecefToGeodeticBatch(PositionKernelIsa isa,
+                         GeodeticMethod method,
+                         const double *xs,
+                         const double *ys,
+                         const double *zs,
+                         size_t count,
+                         double *lats_deg,
+                         double *lons_deg,
+                         double *alts_m);
+
+/**
+ * @brief 緯度経度高度からECEFへまとめて変換するときの、sin/cosの求め方です。
+ *
+ * @details ECEFは位置補間や探知の入力になるため、出力用の変換方法(SOA_GEODETIC)とは別に、呼び出し側が明示して選びます。
+ */
+enum class TrigKernel {
+    /**
+     * @brief libmのsin/cosを1点ずつ呼びます。geodeticToEcefとビット単位で同じ結果です。
+     */
+    LIBM,
+    /**
+     * @brief CPUがAVX2以上なら、sin/cosを多項式で近似するSIMD版を使います。位置の差は1e-9m未満です。
+     */
+    POLYNOMIAL,
+};
+
+/**
+ * @brief 緯度経度高度の配列(lat[], lon[], alt[])をまとめてECEF座標の配列(x[], y[], z[])へ変換します。
+ *
+ * @details trigがPOLYNOMIALでisaがAVX2以上のときは、sin/cosを多項式で近似するSIMD版を使います。
+ *          角度を[-π/4, π/4]へ畳んでから多項式を当てるため、誤差は1e-16程度で、位置の差は1e-9m未満です。
+ *          LIBMのときはgeodeticToEcefを1点ずつ呼ぶため、ビット単位で同じ結果です。
+ */
+void geodeticToEcefBatch(PositionKernelIsa isa,
+                         TrigKernel trig,
+                         const double *lats_deg,
+                         const double *lons_deg,
+                         const double *alts_m,
+                         size_t count,
+                         double *xs,
+                         double *ys,
+                         double *zs);
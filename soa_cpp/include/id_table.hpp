@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief 文字列のIDを、0から順に振った整数(ハンドル)へ置き換える表です。
+ *
+ * @details シナリオ読込時に1回だけ文字列を登録し、シミュレーション中は整数だけで比較・検索します。
+ *          整数の比較やハッシュ計算は文字列よりずっと軽く、コピーしてもヒープ確保が起きません。
+ *          文字列が必要になるのはログへ書き出すときだけで、そのときにname()で元の文字列へ戻します。
+ *          同じ文字列を2回登録すると、同じハンドルが返ります。
+ */
+class IdTable {
+public:
+    /**
+     * @brief 文字列を登録し、そのハンドルを返します。登録済みなら以前と同じハンドルを返します。
+     */
+    uint32_t intern(const std::string &name);
+    /**
+     * @brief ハンドルから元の文字列を返します。
+     */
+    const std::string &name(uint32_t handle) const { return m_names[handle]; }
+    /**
+     * @brief 登録済みの文字列の数です。ハンドルは0からsize()-1までの連番になります。
+     */
+    size_t size() const { return m_names.size(); }
+    /**
+     * @brief 登録内容をすべて消します。
+     */
+    void clear();
+
+private:
+    std::vector<std::string> m_names{};
+    std::unordered_map<std::string, uint32_t> m_handles{};
+};
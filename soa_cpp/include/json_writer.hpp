@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief JSONの文字列を、DOM(nlohmann::json)を作らずに直接組み立てるための再利用できるバッファです。
+ *
+ * @details 毎秒の書き出しのように同じ形の行を何度も作る処理で使います。clear()は中身だけを消して容量を残すため、
+ *          1行目で十分な大きさまで育てば、以降の行ではヒープ確保が起きません。
+ *          数値と文字列の書式はnlohmann::jsonのdump()(インデントなし、ensure_ascii=false)と同じにしてあり、
+ *          同じ値を同じキーの順(std::mapと同じ辞書順)で並べれば、dump()とバイト単位で同じ出力になります。
+ *          キーの順や区切りの記号(「{」「,」「:」など)は呼び出し側がappendRawで並べます。
+ */
+class JsonBuffer {
+public:
+    /**
+     * @brief 中身を空にします。確保済みの容量は残します。
+     */
+    void clear() { m_bytes.clear(); }
+    /**
+     * @brief 記号やキーなど、エスケープの要らない文字列をそのまま追加します。
+     */
+    void appendRaw(const char *text, size_t length) { m_bytes.append(text, length); }
+    /**
+     * @brief 文字列リテラルをそのまま追加します。長さはコンパイル時に決まるため、strlenを呼びません。
+     */
+    template <size_t N>
+    void appendRaw(const char (&text)[N]) { m_bytes.append(text, N - 1); }
+    void appendRaw(const std::string &text) { m_bytes.append(text); }
+    void appendRaw(char c) { m_bytes.push_back(c); }
+    /**
+     * @brief 文字列を「"」で囲み、JSONのエスケープを施して追加します。
+     *
+     * @details 「"」「\」と制御文字(U+001F以下)だけをエスケープし、それ以外のバイトはそのまま書きます。
+     *          入力は正しいUTF-8である前提です(シナリオのJSONから読んだ文字列はnlohmannが検証済みです)。
+     */
+    void appendString(const std::string &text);
+    /**
+     * @brief 整数を10進数で追加します。
+     */
+    void appendInt(int64_t value);
+    /**
+     * @brief 浮動小数点数を、nlohmann::jsonのdump()と同じ書式で追加します。
+     *
+     * @details 元の値へ戻せる最短の桁数(Grisu2)で書き、整数になる値には「.0」を付けます。
+     *          NaNと無限大はdump()と同じくnullになります。
+     */
+    void appendDouble(double value);
+    /**
+     * @brief 組み立てた内容の先頭です。終端の'\0'は保証しません。
+     */
+    const char *data() const { return m_bytes.data(); }
+    size_t size() const { return m_bytes.size(); }
+    /**
+     * @brief 確保済みの容量です。テストで再利用を確かめるために公開しています。
+     */
+    size_t capacity() const { return m_bytes.capacity(); }
+    /**
+     * @brief あらかじめ容量を確保します。
+     */
+    void reserve(size_t capacity) { m_bytes.reserve(capacity); }
+
+private:
+    std::string m_bytes{};
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <vector>
+
+#include "geo.hpp"
+#include "route.hpp"
+
+/**
+ * @brief 位置を保持する座標系(と精度)の種類を表す列挙型です。
+ *
+ * @details ECEF_F64は地球中心の座標をdoubleで持つ標準の方式です。
+ *          ENU_F32はシナリオの中心付近に原点を置いた局所座標(東・北・上)をfloatで持つ方式で、
+ *          原点からの差分だけを持つので値が小さく、floatでも十分な精度になります。
+ *          floatはdoubleの半分の大きさなので、位置・空間ハッシュ・距離計算で読むメモリ量が半分になります。
+ */
+enum class CoordinateMode {
+    ECEF_F64,
+    ENU_F32,
+};
+
+/**
+ * @brief 環境変数SOA_COORDINATE_MODE(ecef/enu32)から座標系を選びます。
+ *
+ * @details 未指定や不明な値のときはECEF_F64です。計測や精度比較のための切り替え口です。
+ */
+CoordinateMode selectCoordinateMode();
+
+/**
+ * @brief 座標系の種類をログや計測結果に出すための文字列へ変換します。
+ */
+const char *coordinateModeName(CoordinateMode mode);
+
+/**
+ * @brief 局所座標(東・北・上)をfloatで表す構造体です。単位はメートルです。
+ */
+struct EnuF32 {
+    float e;
+    float n;
+    float u;
+};
+
+/**
+ * @brief 局所座標で表した1区間分の移動レコードです。
+ *
+ * @details SegmentMotionのfloat版です。区間の開始時刻だけは、経過秒数との差を正確に取るためdoubleのままにします。
+ */
+struct SegmentMotionF32 {
+    EnuF32 start;
+    EnuF32 velocity_mps;
+    double start_sec;
+};
+
+/**
+ * @brief 局所座標系(ENU)の原点と向きを保持する構造体です。
+ *
+ * @details 原点のECEF座標と、ECEFの差分ベクトルを東・北・上の成分へ回す3x3の回転行列を持ちます。
+ *          変換の計算自体はdoubleで行い、結果だけをfloatへ丸めます。
+ */
+struct LocalFrame {
+    Ecef origin{0.0, 0.0, 0.0};
+    Ecef east{1.0, 0.0, 0.0};
+    Ecef north{0.0, 1.0, 0.0};
+    Ecef up{0.0, 0.0, 1.0};
+};
+
+/**
+ * @brief 指定した緯度経度(高度0)を原点とする局所座標系を作ります。
+ */
+LocalFrame makeLocalFrame(double lat_deg, double lon_deg);
+
+/**
+ * @brief 経路点全体の重心の真下(高度0)を原点とする局所座標系を作ります。
+ *
+ * @details 運用範囲の中心に原点を置くことで、局所座標の値の大きさ(=floatの丸め誤差)を最小にします。
+ */
+LocalFrame makeCentroidFrame(const std::vector<RoutePoint> &route_points);
+
+/**
+ * @brief ECEF座標を局所座標へ変換します。
+ */
+EnuF32 ecefToEnu(const LocalFrame &frame, const Ecef &pos);
+
+/**
+ * @brief ECEFの向きだけを持つベクトル(速度など)を局所座標の成分へ回します。原点の移動は行いません。
+ */
+EnuF32 rotateToEnu(const LocalFrame &frame, const Ecef &vec);
+
+/**
+ * @brief 局所座標をECEF座標へ戻します。ログ出力やイベントの緯度経度を求めるときに使います。
+ */
+Ecef enuToEcef(const LocalFrame &frame, const EnuF32 &pos);
+
+/**
+ * @brief ECEFの区間移動レコードを局所座標のレコードへ変換します。
+ */
+SegmentMotionF32 toEnuMotion(const LocalFrame &frame, const SegmentMotion &motion);
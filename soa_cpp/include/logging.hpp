@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdio>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "json_writer.hpp"
 #include "nlohmann/json.hpp"
 #include "spdlog/spdlog.h"
 
@@ -14,6 +17,9 @@ class SoaSimulation;
  *
  * @details シミュレーション本体から「何を書き出すか」を分離し、ファイル操作やJSON変換を
  *          ここに集約することで、初心者でも責務の境界を理解しやすくします。
+ *          タイムラインは毎秒全オブジェクト分の行になり、出力の多い実行では最も重い処理です。
+ *          そのためjsonobjやnlohmann::jsonのDOMを経由せず、使い回すバッファ(JsonBuffer)へ直接書式を整え、
+ *          1秒分を1回の書き込みでファイルへ渡します。出力はnlohmann::jsonのdump()とバイト単位で同じです。
  */
 class TimelineLogger {
 public:
@@ -23,15 +29,48 @@ public:
      * @details ログ書き出しに必要な準備をここで行い、run中は書き出しだけに集中できるようにします。
      */
     void open(const std::string &path);
+    /**
+     * @brief 各オブジェクトの行のうち、毎秒変わらない部分(object_id・role・team_id)を組み立てておきます。
+     *
+     * @details IDや役割はシミュレーション中に変わらないため、文字列の取り出し・役割の文字列化・エスケープは
+     *          ここで1回だけ行います。キーは辞書順に並べるため、変わらない部分は行の後半
+     *          (「,"object_id":...,"role":...,"team_id":...}」)になります。
+     *          配列を並べ替えてもシナリオの順番は変わらないので、シナリオの順番ごとに持ちます。
+     *          シナリオを読み込んで配列を作ったあと、最初のwriteより前に呼んでください。
+     */
+    void prepare(const SoaStorage &storage, const SoaSimulation &simulation);
     /**
      * @brief 1秒分のタイムラインログを生成して書き出します。
      *
      * @details SoA配列から必要な情報を抜き出し、JSONへまとめて1行で保存します。
+     *          オブジェクトごとに書式を整えるのは緯度・経度・高度の3つの数値だけで、残りはprepareで作った部分を写します。
+     *          バッファと作業用の配列は秒をまたいで使い回すため、最初の秒で育ったあとはヒープ確保が起きません。
      */
     void write(int time_sec, const SoaStorage &storage, const SoaSimulation &simulation);
 
 private:
-    std::shared_ptr<spdlog::logger> m_logger{};
+    /**
+     * @brief 出力先のファイルです。標準ライブラリのバッファは使わず、1秒分の行を1回のfwriteでそのまま書き込みます。
+     */
+    std::unique_ptr<std::FILE, int (*)(std::FILE *)> m_file{nullptr, &std::fclose};
+    /**
+     * @brief 1秒分の行を組み立てるバッファです。
+     */
+    JsonBuffer m_buffer{};
+    /**
+     * @brief prepareで組み立てた、各オブジェクトの行の変わらない部分をつなげた文字列です。
+     *
+     * @details シナリオの順番k番目のオブジェクトの部分は、m_row_tail_offsets[k]からm_row_tail_offsets[k + 1]の手前までです。
+     *          1本の文字列にまとめることで、毎秒の書き出しは先頭から順に読むだけになります。
+     */
+    std::string m_row_tails{};
+    std::vector<size_t> m_row_tail_offsets{};
+    /**
+     * @brief 全オブジェクトの緯度経度高度をまとめて求めるための作業用の配列です。容量は秒をまたいで使い回します。
+     */
+    std::vector<double> m_lats{};
+    std::vector<double> m_lons{};
+    std::vector<double> m_alts{};
 };
 
 /**
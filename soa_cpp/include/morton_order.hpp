@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "soa_storage.hpp"
+#include "spatial_hash.hpp"
+
+/**
+ * @brief 環境変数SOA_REORDER_INTERVAL(秒数)から、オブジェクトを空間の順に並べ替える間隔を選びます。
+ *
+ * @details 未指定・0以下・数値でない値のときは0で、並べ替えを行いません。計測や結果比較のための切り替え口です。
+ */
+int selectReorderInterval();
+
+/**
+ * @brief セル座標からMortonコード(Z順序曲線上の位置)を計算します。
+ *
+ * @details 東西・南北のセル座標のビットを交互に並べた64bitの値です。
+ *          この値の順に並べると、平面上で近いセルどうしがおおむね近い順番になります。
+ *          負のセル座標は符号ビットを反転して、大小関係を保ったまま符号なしの値へ移します。
+ */
+uint64_t mortonCode(const CellKey &key);
+
+/**
+ * @brief 全オブジェクトを今いるセルのMortonコードの順に並べたときの添字の並びを求めます。
+ *
+ * @details order[新しい添字] = 今の添字 になります。同じセルのオブジェクトは今の並び順を保ちます。
+ */
+void computeMortonOrder(const SoaStorage &storage, double cell_size, std::vector<uint32_t> &order);
+
+/**
+ * @brief orderの並びに従って、storageのオブジェクトごとの配列をすべて並べ替えます。
+ *
+ * @details new_indicesには new_indices[今の添字] = 新しい添字 を書き込みます。
+ *          スケジューラなど、添字を覚えている側の書き換えに使ってください。
+ *          経路点や区間のように添字のオフセットで引く配列は動かさず、オフセットのほうを並べ替えます。
+ *          scenario_orderも書き換えるため、シナリオの順番で出力する処理はそのまま同じ結果になります。
+ */
+void applyStorageOrder(SoaStorage &storage, const std::vector<uint32_t> &order, std::vector<uint32_t> &new_indices);
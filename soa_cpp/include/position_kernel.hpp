@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+
+#include "geo.hpp"
+#include "soa_storage.hpp"
+
+/**
+ * @brief 位置補間カーネルの実装種別(命令セット)を表す列挙型です。
+ *
+ * @details SIMD(1命令で複数データを処理する仕組み)はCPUによって使える命令が異なるため、
+ *          実行時にCPUの機能を調べて、使える中で最も幅の広いものを選びます。
+ */
+enum class PositionKernelIsa {
+    SCALAR,
+    AVX2,
+    AVX512,
+};
+
+/**
+ * @brief 指定したカーネルを実行中のCPUで使えるかどうかを返します。
+ *
+ * @details SCALARは常に使えます。x86_64以外やGCC/Clang以外のビルドではSIMD版は使えません。
+ */
+bool isPositionKernelIsaSupported(PositionKernelIsa isa);
+
+/**
+ * @brief 実行中のCPUで使える最も幅の広い位置補間カーネルを返します。
+ *
+ * @details 環境変数SOA_POSITION_KERNEL(scalar/avx2/avx512)が指定されていれば、
+ *          CPUが対応している範囲でその指定を優先します。計測や結果比較のための切り替え口です。
+ */
+PositionKernelIsa selectPositionKernelIsa();
+
+/**
+ * @brief カーネル種別をログや計測結果に出すための文字列へ変換します。
+ */
+const char *positionKernelIsaName(PositionKernelIsa isa);
+
+/**
+ * @brief 1体分の位置をスカラー(1件ずつ)で補間します。
+ *
+ * @details SIMD版で扱いにくい分岐(経路なし・区間またぎ・速度0の区間など)もすべてここで処理します。
+ *          SIMD版はこの関数と同じ演算順序で計算するため、結果はビット単位で一致します。
+ */
+Ecef interpolatePositionScalar(SoaStorage &storage, size_t index, int time_sec);
+
+/**
+ * @brief indicesで指定したオブジェクトの位置を指定のカーネルで計算し、SoAの位置配列へ直接書き込みます。
+ *
+ * @details 移動中のオブジェクトだけを渡せば、止まっているオブジェクトの位置は前回の値のまま残ります。
+ *          区間カーソルもstorageへ書き戻します。
+ */
+void computePositions(PositionKernelIsa isa,
+                      SoaStorage &storage,
+                      int time_sec,
+                      const size_t *indices,
+                      size_t count);
+
+/**
+ * @brief indicesで指定したオブジェクトの位置を局所座標(float)で計算し、enu_*配列へ書き込みます。
+ *
+ * @details 座標系がENU_F32のときに使う版です。分岐の順序はスカラー版と同じで、
+ *          区間の特定(区間カーソル)は時刻の比較を誤らないようdoubleのまま行い、位置の計算だけをfloatで行います。
+ */
+void computePositionsEnuF32(SoaStorage &storage,
+                            int time_sec,
+                            const size_t *indices,
+                            size_t count);
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "position_kernel.hpp"
+
+/**
+ * @brief 探知の距離判定(ナローフェーズ)で、近傍探索が拾った相手の位置を1か所に集めておくための作業用の配列です。
+ *
+ * @details 相手の位置はSoA配列の飛び飛びの場所にあるため、いったん連続したx/y/zの配列へ写し取ってから、
+ *          SIMD命令で複数の相手との距離の2乗をまとめて求めます。配列は全斥候で使い回すため、
+ *          clearしても容量は残り、2秒目以降はヒープ確保が起きません。
+ */
+struct RangeCandidates {
+    std::vector<double> xs{};
+    std::vector<double> ys{};
+    std::vector<double> zs{};
+    /**
+     * @brief 集めた相手のSoA配列での添字です。xs/ys/zsと同じ順番に並びます。
+     */
+    std::vector<uint32_t> indices{};
+    /**
+     * @brief filterWithinRangeで範囲内と判定した相手の「集めた順番」と、その距離の2乗です。
+     */
+    std::vector<uint32_t> passed{};
+    std::vector<double> passed_dist_sqs{};
+
+    void clear() {
+        xs.clear();
+        ys.clear();
+        zs.clear();
+        indices.clear();
+    }
+
+    void push(uint32_t index, double x, double y, double z) {
+        indices.push_back(index);
+        xs.push_back(x);
+        ys.push_back(y);
+        zs.push_back(z);
+    }
+
+    size_t size() const { return indices.size(); }
+};
+
+/**
+ * @brief 集めた相手のうち、中心からの距離の2乗がrange_sq以下のものを選び、passedとpassed_dist_sqsへ詰めて書き込みます。
+ *
+ * @details 平方根は取らず、距離の2乗どうしで比べます。平方根が要るのは範囲内と判定した相手のイベント用の距離だけなので、
+ *          呼び出し側でpassed_dist_sqsから求めます。
+ *          isaで指定したSIMD幅(AVX-512なら8体、AVX2なら4体)ずつ比べ、端数はスカラーで比べます。
+ *          判定結果は分岐ではなく「書き込み位置を範囲内のときだけ1進める」形で詰めるため、内側のループに分岐がありません。
+ *          距離の2乗は distanceEcef と同じ演算順序(dx*dx + dy*dy + dz*dz)で求めるため、どの命令セットでもビット単位で同じ値です。
+ *          戻り値は範囲内と判定した数です。
+ */
+size_t filterWithinRange(PositionKernelIsa isa, const Ecef &center, double range_sq, RangeCandidates &candidates);
@@ -3,11 +3,33 @@
 #include <string>
 #include <vector>
 
+#include "aabb_tree.hpp"
+#include "activation_scheduler.hpp"
+#include "broadphase.hpp"
 #include "geo.hpp"
+#include "jsonobj/detection_event.hpp"
 #include "jsonobj/scenario.hpp"
+#include "local_frame.hpp"
 #include "logging.hpp"
+#include "morton_order.hpp"
+#include "position_kernel.hpp"
+#include "range_kernel.hpp"
 #include "soa_storage.hpp"
 #include "spatial_hash.hpp"
+#include "sweep_and_prune.hpp"
+
+/**
+ * @brief 斥候1体分の探知処理で、近傍から見つけた相手を一時的に集めるための構造体です。
+ *
+ * @details 見つけた順番(order)も持たせ、同じハンドルが2回見つかったときは先に見つけたほうを残します。
+ *          緯度経度はイベントを書き出すときにだけ求めればよいため、ここでは相手の添字と距離だけを持ちます。
+ */
+struct DetectionCandidate {
+    uint32_t target = 0;
+    uint32_t order = 0;
+    uint32_t object_index = 0;
+    int distance_m = 0;
+};
 
 /**
  * @brief シミュレーション全体の流れを管理するクラスです。
@@ -37,6 +59,68 @@ public:
      * @details 1秒刻みのループを回し、位置更新やイベント判定をここに集約します。
      */
     void run();
+    /**
+     * @brief 1秒分の更新(位置更新・探知・爆破)を行います。タイムラインの出力は含みません。
+     *
+     * @details runの1回分のループ本体です。毎秒使う作業領域はプールや確保済みの配列を使い回すため、
+     *          定常状態(イベントが出ない秒)ではヒープ確保を行いません。
+     *          time_secは0から1ずつ増やして呼び出してください。
+     */
+    void step(int time_sec);
+    /**
+     * @brief 1秒前の位置(prev_ecef_*)を毎秒残すかどうかを切り替えます。
+     *
+     * @details 既定では無効です。有効にすると位置更新の直前に現在位置を写し取るため、
+     *          オブジェクト数に比例したコピーが毎秒1回増えます。
+     */
+    void setKeepPreviousPositions(bool keep) { m_keep_previous_positions = keep; }
+    /**
+     * @brief 毎秒、空間格子が現在位置と一致しているかを総当たりで確かめるかどうかを切り替えます。
+     *
+     * @details 既定値は環境変数SOA_SPATIAL_CHECK(1で有効)で決まります。
+     *          食い違いが見つかるとstepがstd::runtime_errorを投げます。
+     */
+    void setSpatialCheck(bool check) { m_spatial_check = check; }
+    /**
+     * @brief 位置を保持する座標系を切り替えます。initializeより前に呼び出してください。
+     *
+     * @details 既定値は環境変数SOA_COORDINATE_MODEで決まります(未指定ならECEF_F64)。
+     *          ENU_F32ではシナリオ中心の局所座標をfloatで持ち、ECEFはタイムライン出力の直前にだけ作り直します。
+     */
+    void setCoordinateMode(CoordinateMode mode) { m_coordinate_mode = mode; }
+    /**
+     * @brief 探知状態の持ち方を切り替えます。initializeより前に呼び出してください。
+     *
+     * @details 既定値は環境変数SOA_DETECTION_STATEで決まります(未指定ならSORTED_VECTOR)。
+     *          どちらの方式でも探知・失探イベントの内容と順番は同じです。
+     */
+    void setDetectionBackend(DetectionBackend backend) { m_detection_backend = backend; }
+    /**
+     * @brief オブジェクトの配列を何秒ごとに空間の順(Mortonコード順)へ並べ替えるかを設定します。0で並べ替えません。
+     *
+     * @details initializeより前に呼び出してください。既定値は環境変数SOA_REORDER_INTERVALで決まります(未指定なら0)。
+     *          並べ替えても、タイムラインとイベントはシナリオの順番で出力されるため、ログの内容は変わりません。
+     */
+    void setReorderInterval(int interval_sec) { m_reorder_interval = interval_sec; }
+    /**
+     * @brief 探知の近傍探索の方式を切り替えます。initializeより前に呼び出してください。
+     *
+     * @details 既定値は環境変数SOA_BROADPHASEで決まります(未指定ならGRID)。
+     *          どちらの方式でも探知・失探イベントの内容と順番は同じです。
+     */
+    void setBroadphase(Broadphase broadphase) { m_broadphase = broadphase; }
+    /**
+     * @brief initializeで選んだSIMD命令セットです。タイムラインの緯度経度をまとめて求めるときにも同じものを使います。
+     */
+    PositionKernelIsa positionKernelIsa() const { return m_position_isa; }
+    /**
+     * @brief index番目のオブジェクトの現在位置をECEFで返します。座標系によらず使えます。
+     */
+    Ecef objectPosition(size_t index) const;
+    /**
+     * @brief SoA配列を参照します。検証やテストで現在の状態を確認するために使います。
+     */
+    const SoaStorage &storage() const { return m_storage; }
 
 private:
     /**
@@ -52,30 +136,112 @@ private:
      */
     void buildStorage(const jsonobj::Scenario &scenario);
     /**
-     * @brief 指定時刻に合わせて全オブジェクトの位置を更新します。
+     * @brief 指定時刻に合わせて移動中のオブジェクトの位置を更新します。
      *
      * @details ルート補間の手順を1箇所にまとめ、run内の責務を明確化します。
+     *          止まっているオブジェクトは前回の位置のままなので、スケジューラの移動中リストだけを
+     *          SoAの位置配列へ直接書き込みます。区間番号のカーソルも書き戻し、次の秒の探索を省きます。
+     */
+    void updatePositions(int time_sec);
+    /**
+     * @brief オブジェクトの配列を、今いるセルのMortonコード順に並べ替えます。
+     *
+     * @details 同じセルや隣のセルにいるオブジェクトが配列の近い位置に集まるため、
+     *          探知の近傍探索で読む位置がまとまり、キャッシュに載りやすくなります。
+     *          スケジューラの添字も書き換え、空間格子は新しい添字で作り直します。すでに並んでいるときは何もしません。
      */
-    std::vector<Ecef> updatePositions(const SoaStorage &storage, int time_sec) const;
+    void reorderObjects();
+    /**
+     * @brief 選んでいる近傍探索の方式(空間格子・スイープ・動的AABB木)を、今の位置と添字で作り直します。
+     */
+    void buildBroadphase();
     /**
      * @brief 斥候1体分の探知・失探イベントを生成します。
      *
-     * @details 空間ハッシュの近傍だけを調べ、イベント出力を最小限に抑えます。
+     * @details 空間格子の近傍(SWEEP_AND_PRUNE方式では軸上の近傍、DYNAMIC_BVH方式では木の探索で拾った相手)だけを調べ、
+     *          イベント出力を最小限に抑えます。
+     *          今の秒で探知した相手をハンドルの昇順に並べ、前の秒の状態と先頭から突き合わせて
+     *          探知(今だけにいる)と失探(前だけにいる)を1回の走査で求めます。
+     *          探知状態には相手のECEFの位置を持ち、緯度経度への変換はイベントを出す相手の分だけ行います。
+     *          BITMATRIX方式では、突き合わせをdiffDetectionBitmatrixに任せます。
      */
     void updateDetectionForScout(
         int time_sec,
-        size_t scout_index,
-        const std::unordered_map<CellKey, std::vector<int>, CellKeyHash> &spatial_hash);
+        size_t scout_index);
+    /**
+     * @brief 集めた探知候補をビット行列の行へ書き込み、前の秒とのビットの差から探知・失探イベントを出します。
+     *
+     * @details 探知を続けているだけの相手は緯度経度を求めず、イベントを出す相手だけ変換します。
+     */
+    void diffDetectionBitmatrix(int time_sec, size_t scout_index);
+    /**
+     * @brief 探知・失探イベントを1件イベントログへ書き出します。
+     *
+     * @details 相手の位置はECEFのまま受け取り、緯度経度への変換はイベントを書き出すこの時点でだけ行います。
+     */
+    void emitDetectionEvent(int time_sec,
+                            size_t scout_index,
+                            jsonobj::DetectionAction action,
+                            uint32_t target,
+                            const ContactPayload &contact);
     /**
      * @brief 攻撃役1体分の爆破イベントを生成します。
      *
      * @details 1回だけ発生させるため、内部の状態で再発火を抑制します。
      */
     void emitDetonationForAttacker(int time_sec, size_t attacker_index);
+    /**
+     * @brief 2体間の距離を、いまの座標系の配列から計算します。
+     */
+    double distanceBetween(size_t a, size_t b) const;
+    /**
+     * @brief 局所座標の位置からECEFの位置配列を作り直します。ENU_F32でタイムラインを出力する直前に使います。
+     */
+    void syncEcefFromEnu();
 
     bool m_initialized = false;
     jsonobj::Scenario m_scenario{};
     SoaStorage m_storage{};
+    /**
+     * @brief 探知の近傍探索に使う空間格子です。initializeで作り、毎秒動いたオブジェクトの分だけ更新します。
+     */
+    SpatialGrid m_spatial_grid{};
+    /**
+     * @brief SWEEP_AND_PRUNE方式で使う、軸上の座標順の並びです。GRID方式では使いません。
+     */
+    SweepAndPrune m_sweep{};
+    /**
+     * @brief DYNAMIC_BVH方式で使う動的AABB木です。ほかの方式では使いません。
+     */
+    DynamicAabbTree m_bvh{};
+    Broadphase m_broadphase = selectBroadphase();
+    /**
+     * @brief チーム番号ごとの相手チームの集合です。斥候はこのマスクのチームのリストだけを調べます。
+     */
+    std::vector<TeamMask> m_enemy_masks{};
+    bool m_spatial_check = selectSpatialCheck();
+    /**
+     * @brief 斥候1体分の「今の秒で探知した相手」を集める作業用の配列です。全斥候で使い回します。
+     *
+     * @details clearしても容量は残るため、2秒目以降は確保済みのメモリを再利用するだけになります。
+     */
+    std::vector<DetectionCandidate> m_detection_candidates{};
+    /**
+     * @brief 近傍探索で拾った相手の位置を集める作業用の配列です。距離の判定はここからSIMD命令でまとめて行います。
+     */
+    RangeCandidates m_range_candidates{};
+    DetectionState m_current_detected{};
+    bool m_keep_previous_positions = false;
+    CoordinateMode m_coordinate_mode = selectCoordinateMode();
+    DetectionBackend m_detection_backend = selectDetectionBackend();
+    int m_reorder_interval = selectReorderInterval();
+    /**
+     * @brief 並べ替えで使う作業用の配列です。order[新しい添字] = 今の添字、new_indices[今の添字] = 新しい添字です。
+     */
+    std::vector<uint32_t> m_reorder_order{};
+    std::vector<uint32_t> m_reorder_new_indices{};
+    ActivationScheduler m_scheduler{};
+    PositionKernelIsa m_position_isa = PositionKernelIsa::SCALAR;
     TimelineLogger m_timeline_logger{};
     EventLogger m_event_logger{};
     int m_end_sec = 24 * 60 * 60;
@@ -1,24 +1,29 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
+#include "detection_bitmatrix.hpp"
+#include "id_table.hpp"
 #include "jsonobj/scenario.hpp"
+#include "local_frame.hpp"
 #include "route.hpp"
 
 /**
- * @brief 探知した相手の情報を保持し、失探判定に利用するための構造体です。
+ * @brief 斥候1体分の探知状態です。
  *
- * @details 斥候ごとに「前の時刻で探知していた相手」を覚えるために使います。
- *          これにより、今は見えていない相手を「失探」として記録できるようになります。
+ * @details targetsは探知中の相手のオブジェクトハンドルを昇順に並べた配列で、contactsは同じ並びの探知情報(ECEFの位置と距離)です。
+ *          斥候ごとに「前の時刻で探知していた相手」を覚えておくことで、今は見えていない相手を「失探」として記録できます。
+ *          緯度経度は探知・失探イベントを書き出す相手の分だけ求めればよいため、ここではECEFのまま持ちます。
+ *          斥候1体が同時に探知する相手は数体なので、ハッシュ表よりも小さな整列済み配列のほうが軽く扱えます。
+ *          前の秒と今の秒の状態がどちらも昇順なので、探知・失探の差分は先頭から1回なめるだけで求まります。
+ *          毎秒中身を書き換えるだけで配列の容量はそのまま残るため、定常状態ではヒープ確保が起きません。
  */
-struct DetectionInfo {
-    double lat_deg = 0.0;
-    double lon_deg = 0.0;
-    double alt_m = 0.0;
-    int distance_m = 0;
+struct DetectionState {
+    std::vector<uint32_t> targets;
+    std::vector<ContactPayload> contacts;
 };
 
 /**
@@ -30,8 +35,19 @@ struct DetectionInfo {
  *          学習用として、どちらの利点も意識できるようにコメントを残しています。
  */
 struct SoaStorage {
-    std::vector<std::string> object_ids;
-    std::vector<std::string> team_ids;
+    /**
+     * @brief オブジェクトIDとチームIDの文字列表です。文字列はログへ書き出すときだけ引きます。
+     */
+    IdTable object_names;
+    IdTable team_names;
+    /**
+     * @brief 各オブジェクトのIDのハンドル(object_namesの番号)です。配列の長さがオブジェクト数になります。
+     */
+    std::vector<uint32_t> object_handles;
+    /**
+     * @brief 各オブジェクトの所属チームの番号(team_namesの番号)です。味方の判定は整数の比較で行います。
+     */
+    std::vector<uint8_t> team_indices;
     std::vector<jsonobj::Role> roles;
     std::vector<int> start_secs;
 
@@ -39,16 +55,77 @@ struct SoaStorage {
     std::vector<double> ecef_ys;
     std::vector<double> ecef_zs;
 
+    /**
+     * @brief 位置をどの座標系で保持しているかです。ENU_F32のときはenu_*が正で、ecef_*はログ出力の直前にだけ作り直します。
+     */
+    CoordinateMode coordinate_mode = CoordinateMode::ECEF_F64;
+    /**
+     * @brief 局所座標系の原点と向きです。ENU_F32の位置と、空間格子のセル分け(接平面への投影)に使います。
+     */
+    LocalFrame frame{};
+    /**
+     * @brief 局所座標(東・北・上)でのfloat位置です。ENU_F32のときだけ使います。
+     */
+    std::vector<float> enu_es;
+    std::vector<float> enu_ns;
+    std::vector<float> enu_us;
+
+    /**
+     * @brief 1秒前の位置です。前の秒の値が必要な処理のための二重バッファで、有効なときだけ更新します。
+     *
+     * @details ECEF_F64のときの位置を写し取るものです。ENU_F32では更新しません。
+     */
+    std::vector<double> prev_ecef_xs;
+    std::vector<double> prev_ecef_ys;
+    std::vector<double> prev_ecef_zs;
+
     std::vector<RoutePoint> route_points;
+    /**
+     * @brief 経路点の局所座標です。route_pointsと同じ添字で並び、ENU_F32のときだけ作ります。
+     */
+    std::vector<EnuF32> route_enus;
     std::vector<size_t> route_offsets;
     std::vector<size_t> route_counts;
 
     std::vector<double> segment_end_secs;
+    /**
+     * @brief 区間ごとの移動レコード(始点・速度・開始時刻)です。segment_end_secsと同じ添字で並びます。
+     */
+    std::vector<SegmentMotion> segment_motions;
+    /**
+     * @brief 区間移動レコードの局所座標版です。segment_motionsと同じ添字で並び、ENU_F32のときだけ作ります。
+     */
+    std::vector<SegmentMotionF32> segment_motions_enu;
     std::vector<size_t> segment_offsets;
     std::vector<size_t> segment_counts;
+    std::vector<size_t> segment_cursors;
 
     std::vector<double> total_duration_secs;
 
-    std::vector<std::unordered_map<std::string, DetectionInfo>> detect_states;
+    std::vector<DetectionState> detect_states;
+    /**
+     * @brief BITMATRIX方式の探知状態です。行はオブジェクトの添字で、斥候の行だけを使います。
+     *
+     * @details detection_backendがBITMATRIXのときはdetect_statesの代わりにこちらを更新します。
+     */
+    DetectionBitmatrix detection_bits;
+    DetectionBackend detection_backend = DetectionBackend::SORTED_VECTOR;
     std::vector<bool> has_detonated;
+    /**
+     * @brief シナリオファイルでk番目に書かれたオブジェクトが、いま配列の何番目にあるかです。
+     *
+     * @details 配列はMortonコード順に並べ替えることがあるため(SOA_REORDER_INTERVAL)、
+     *          ログやイベントをシナリオの順番で出す処理は、配列の添字ではなくこの表の順に回します。
+     *          並べ替えないときは0, 1, 2, ...のままです。
+     */
+    std::vector<uint32_t> scenario_order;
+
+    /**
+     * @brief index番目のオブジェクトのID文字列を返します。
+     */
+    const std::string &objectId(size_t index) const { return object_names.name(object_handles[index]); }
+    /**
+     * @brief index番目のオブジェクトの所属チームID文字列を返します。
+     */
+    const std::string &teamId(size_t index) const { return team_names.name(team_indices[index]); }
 };
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <unordered_map>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 #include "geo.hpp"
@@ -9,40 +11,207 @@
 /**
  * @brief 空間ハッシュ用のセル座標を表す構造体です。
  *
- * @details 探知範囲ごとに空間を立方体セルに区切り、同じセル内の候補だけを探すために使います。
+ * @details 探知範囲ごとにシナリオ中心の接平面(東・北の2軸)を正方形セルに区切り、近くのセルの候補だけを探すために使います。
+ *          オブジェクトはほぼ海面付近にいるため、高さ方向にもセルを分けると中身のないセルを調べるだけになります。
+ *          高さの差は、候補に対する正確な距離判定でだけ考えます。
  */
 struct CellKey {
     int x;
     int y;
-    int z;
 };
 
 /**
  * @brief CellKey同士の等価判定を定義します。
  *
- * @details unordered_mapでキー比較が必要になるため、3軸が同じかを明示的に比較します。
+ * @details ハッシュ表でキー比較が必要になるため、2軸が同じかを明示的に比較します。
  */
 inline bool operator==(const CellKey &a, const CellKey &b) {
-    return a.x == b.x && a.y == b.y && a.z == b.z;
+    return a.x == b.x && a.y == b.y;
 }
 
 /**
- * @brief CellKeyをunordered_mapで使えるようにするハッシュ関数です。
+ * @brief CellKeyのハッシュ値を計算する関数オブジェクトです。
+ *
+ * @details 空間格子のハッシュ表は下位ビットで位置を決めるため、2軸の値を掛け算で全ビットに混ぜてから返します。
  */
 struct CellKeyHash {
     size_t operator()(const CellKey &key) const;
 };
 
 /**
- * @brief 位置とセルサイズからセル座標を計算します。
+ * @brief ECEFの位置を局所座標系の接平面(東・北)へ投影し、セル座標を計算します。
+ *
+ * @details 平面への直交投影では2点の間隔が縮むことはあっても伸びることはないため、
+ *          距離がセルサイズ以内の2点は、必ず東西・南北ともに隣り合う(または同じ)セルに入ります。
+ *          そのため近傍3x3セルを調べれば、立方体セルの近傍27セルを調べたときと同じ相手が見つかります。
  */
-CellKey cellKey(const Ecef &pos, double cell_size);
+CellKey cellKey(const LocalFrame &frame, const Ecef &pos, double cell_size);
 
 /**
- * @brief SoAの位置配列から空間ハッシュを構築します。
+ * @brief 局所座標(float)とセルサイズからセル座標を計算します。東・北の成分だけを使います。
+ */
+CellKey cellKey(const EnuF32 &pos, double cell_size);
+
+/**
+ * @brief storageの座標系に合わせて、index番目のオブジェクトのセル座標を計算します。
+ */
+CellKey objectCellKey(const SoaStorage &storage, size_t index, double cell_size);
+
+/**
+ * @brief チーム番号(0〜255)の集合を256bitで表す型です。斥候が調べる相手チームを表すのに使います。
  *
- * @details 探知処理の前に候補を絞り込むための前処理です。
+ * @details 3チーム以上のシナリオでも、斥候は自分以外のチームのビットが立ったマスクをたどるだけで済みます。
+ */
+struct TeamMask {
+    std::array<uint64_t, 4> words{};
+
+    void set(uint8_t team) { words[team / 64u] |= uint64_t{1} << (team % 64u); }
+    bool test(uint8_t team) const { return ((words[team / 64u] >> (team % 64u)) & 1u) != 0; }
+    /**
+     * @brief 立っているビットのチーム番号を昇順にfn(team)で受け取ります。
+     */
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (size_t w = 0; w < words.size(); ++w) {
+            uint64_t bits = words[w];
+            while (bits != 0) {
+                int bit = __builtin_ctzll(bits);
+                bits &= bits - 1;
+                fn(static_cast<uint8_t>(w * 64u + static_cast<size_t>(bit)));
+            }
+        }
+    }
+};
+
+/**
+ * @brief 環境変数SOA_SPATIAL_CHECKが1のときtrueを返します。空間格子を毎秒検証するかどうかの切り替え口です。
  */
-std::unordered_map<CellKey, std::vector<int>, CellKeyHash> buildSpatialHash(
-    const SoaStorage &storage,
-    double cell_size);
+bool selectSpatialCheck();
+
+/**
+ * @brief 局所座標系の接平面(東・北)を正方形のセルに区切り、セルごとにそこにいるオブジェクトをつないだ空間格子です。
+ *
+ * @details セル座標はcellKeyで位置を接平面へ投影して求めるため、高さ方向には区切りません。
+ *          距離がセルサイズ以内の相手は必ず近傍3x3セルに入るので、斥候は9セルだけを調べれば済みます。
+ *          リストは(チーム, セル)の組ごとに分けて持ちます。斥候は相手チームのリストだけをたどればよいため、
+ *          同じチームの候補を距離計算の前に読み飛ばす比較が要りません。
+ *
+ *          1秒で動く距離は数十m程度で、セルの幅(探知距離、10km程度)よりずっと小さいため、
+ *          毎秒セルをまたぐオブジェクトはほとんどいません。そこで格子は毎秒作り直さず持ち続け、
+ *          位置が変わったオブジェクトだけ新旧のセル座標を比べて、またいだものだけを付け替えます。
+ *          各セルのオブジェクトは添字の配列(m_next/m_prev)でつないだ双方向リストなので、
+ *          付け替えはつなぎ替えだけで済み、ヒープ確保も起きません。
+ *          セル内の並び順は決まっていないため、使う側は順番に依存しないようにしてください
+ *          (探知処理は相手をハンドルの順に並べ直すので影響しません)。
+ */
+class SpatialGrid {
+public:
+    /**
+     * @brief 1セル分のリストをたどる前方イテレータです。
+     */
+    class Iterator {
+    public:
+        Iterator(const int *next, int index) : m_next(next), m_index(index) {}
+        int operator*() const { return m_index; }
+        Iterator &operator++() {
+            m_index = m_next[m_index];
+            return *this;
+        }
+        bool operator!=(const Iterator &other) const { return m_index != other.m_index; }
+
+    private:
+        const int *m_next;
+        int m_index;
+    };
+
+    /**
+     * @brief 1セル分のオブジェクト番号の範囲です。範囲for文でそのまま回せます。
+     */
+    struct CellRange {
+        const int *next = nullptr;
+        int head = -1;
+        Iterator begin() const { return Iterator(next, head); }
+        Iterator end() const { return Iterator(next, -1); }
+    };
+
+    /**
+     * @brief 全オブジェクトの位置から格子を作り直します。initializeで1回だけ呼びます。
+     *
+     * @details cell_sizeが0以下のときは空の格子になり、updateも何もしません。
+     *          座標系がENU_F32のときは局所座標のfloat配列からセルを求めます。
+     */
+    void build(const SoaStorage &storage, double cell_size);
+    /**
+     * @brief indicesに挙げたオブジェクトのセルを調べ直し、セルをまたいだものだけ付け替えます。
+     *
+     * @details 位置を書き換えたオブジェクト(移動中リスト)だけを渡します。
+     *          かかる時間は渡した数の比較と、またいだ数のつなぎ替えだけです。
+     */
+    void update(const SoaStorage &storage, const size_t *indices, size_t count);
+    /**
+     * @brief 指定したセルにいる、指定したチームのオブジェクト番号の範囲を返します。誰もいないときは空の範囲です。
+     */
+    CellRange cell(uint8_t team, const CellKey &key) const;
+    /**
+     * @brief 直前のupdateでセルをまたいだオブジェクトの数です。計測や検証に使います。
+     */
+    size_t lastCrossingCount() const { return m_last_crossings; }
+    /**
+     * @brief 格子がstorageの現在位置と一致しているかを総当たりで確かめます。
+     *
+     * @details すべてのオブジェクトが今の位置のセルのリストに1回ずつ入っていること、
+     *          各セルの人数とリストの長さが一致することを調べ、食い違いがあればstd::runtime_errorを投げます。
+     *          毎秒呼ぶと全オブジェクト分の計算が増えるため、検証モード(SOA_SPATIAL_CHECK=1)でだけ使います。
+     */
+    void verify(const SoaStorage &storage) const;
+
+private:
+    /**
+     * @brief ハッシュ表の1枠です。一度使ったセルは空になっても枠を残し、番号を使い回します。
+     */
+    struct Slot {
+        CellKey key{0, 0};
+        uint32_t cell = 0;
+        uint8_t team = 0;
+        bool used = false;
+    };
+    /**
+     * @brief 1セル分のリストの先頭と人数です。
+     */
+    struct Cell {
+        int head = -1;
+        uint32_t count = 0;
+    };
+
+    /**
+     * @brief (team, key)が入っている枠、なければ次に使う空き枠の位置を線形探索で探します。
+     */
+    size_t findSlot(uint8_t team, const CellKey &key) const;
+    /**
+     * @brief (team, key)のセル番号を返します。初めて使う組なら番号を振ります。
+     */
+    uint32_t findOrAddCell(uint8_t team, const CellKey &key);
+    /**
+     * @brief index番目のオブジェクトをcellのリストの先頭へつなぎます。
+     */
+    void link(size_t index, uint32_t cell);
+    /**
+     * @brief index番目のオブジェクトを今のセルのリストから外します。
+     */
+    void unlink(size_t index);
+    /**
+     * @brief 全オブジェクトを今の位置のセルへつなぎ直します。buildと、空のセルを掃除するときに使います。
+     */
+    void relinkAll(const SoaStorage &storage);
+
+    std::vector<Slot> m_slots{};
+    std::vector<Cell> m_cells{};
+    std::vector<CellKey> m_object_keys{};
+    std::vector<uint32_t> m_object_cells{};
+    std::vector<int> m_next{};
+    std::vector<int> m_prev{};
+    size_t m_slot_mask = 0;
+    size_t m_cell_capacity = 0;
+    size_t m_last_crossings = 0;
+    double m_cell_size = 0.0;
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "local_frame.hpp"
+#include "route.hpp"
+#include "soa_storage.hpp"
+
+/**
+ * @brief スイープ(座標順の並び)に使う局所座標系の軸です。
+ */
+enum class SweepAxis {
+    EAST,
+    NORTH,
+};
+
+/**
+ * @brief 経路点が東西と南北のどちらに広く散らばっているかを調べ、広いほうの軸を返します。
+ *
+ * @details 散らばりの大きい軸で並べるほど、軸上で近くにいるのに実際は遠い相手が減り、調べる候補が少なくなります。
+ */
+SweepAxis selectDominantAxis(const LocalFrame &frame, const std::vector<RoutePoint> &route_points);
+
+/**
+ * @brief storageの座標系に合わせて、index番目のオブジェクトの軸上の座標(メートル)を求めます。
+ *
+ * @details ECEF_F64では局所座標系の原点からの差分を軸の向きへ射影し、ENU_F32ではfloatの成分をそのまま使います。
+ */
+double sweepCoordinate(const SoaStorage &storage, size_t index, SweepAxis axis);
+
+/**
+ * @brief 全オブジェクトを軸上の座標の昇順に並べて持ち続ける、スイープ・アンド・プルーン方式の近傍探索です。
+ *
+ * @details 軸への射影では2点の間隔が縮むことはあっても伸びることはないため、距離が探知距離以内の相手は
+ *          軸上でも探知距離以内に並んでいます。斥候は並びの中の自分の位置から左右へ、軸上の差が探知距離を超えるまで進むだけで済みます。
+ *
+ *          1秒で動く距離は小さいので、前の秒の並びはほとんど崩れていません。そこで毎秒並べ直すのではなく、
+ *          動いたオブジェクトの座標だけ書き換えてから挿入ソートをかけます。挿入ソートの時間は
+ *          「オブジェクト数 + 入れ替えた回数」なので、ほぼ並んでいる配列ではほぼ1回なめるだけになります。
+ *          配列は容量を使い回すため、buildの後はヒープ確保が起きません。
+ */
+class SweepAndPrune {
+public:
+    /**
+     * @brief 全オブジェクトの座標を求めて並べます。initializeと、オブジェクトの並べ替えの後に呼びます。
+     */
+    void build(const SoaStorage &storage, SweepAxis axis);
+    /**
+     * @brief indicesに挙げたオブジェクトの座標を書き換え、挿入ソートで並びを直します。
+     *
+     * @details 位置を書き換えたオブジェクト(移動中リスト)だけを渡します。
+     */
+    void update(const SoaStorage &storage, const size_t *indices, size_t count);
+    /**
+     * @brief index番目のオブジェクトと軸上の差がrange以内にいる、ほかのオブジェクトの番号をfn(other)で受け取ります。
+     *
+     * @details 並びの中の位置から左へ、次に右へ進みます。受け取る順番は決まっていないため、
+     *          使う側は順番に依存しないようにしてください(探知処理は相手をハンドルの順に並べ直すので影響しません)。
+     */
+    template <typename Fn>
+    void forEachNear(size_t index, double range, Fn fn) const {
+        size_t rank = m_ranks[index];
+        double key = m_entries[rank].key;
+        for (size_t pos = rank; pos > 0 && key - m_entries[pos - 1].key <= range; --pos) {
+            fn(static_cast<size_t>(m_entries[pos - 1].index));
+        }
+        for (size_t pos = rank + 1; pos < m_entries.size() && m_entries[pos].key - key <= range; ++pos) {
+            fn(static_cast<size_t>(m_entries[pos].index));
+        }
+    }
+    /**
+     * @brief 並べている軸です。
+     */
+    SweepAxis axis() const { return m_axis; }
+    /**
+     * @brief 直前のupdateの挿入ソートで要素を入れ替えた回数です。計測や検証に使います。
+     */
+    size_t lastSwapCount() const { return m_last_swaps; }
+    /**
+     * @brief 並びがstorageの現在位置と一致しているかを総当たりで確かめます。
+     *
+     * @details すべてのオブジェクトが1回ずつ並びに入っていること、座標が今の位置と同じであること、
+     *          昇順に並んでいることを調べ、食い違いがあればstd::runtime_errorを投げます。
+     *          検証モード(SOA_SPATIAL_CHECK=1)でだけ使います。
+     */
+    void verify(const SoaStorage &storage) const;
+
+private:
+    /**
+     * @brief 並びの1件分です。座標と、オブジェクトの番号を持ちます。
+     *
+     * @details 座標と番号を同じ要素に入れておくと、左右へ進むときに読むメモリが連続します。
+     */
+    struct Entry {
+        double key;
+        uint32_t index;
+    };
+
+    /**
+     * @brief 挿入ソートで並びを直し、動いた要素の位置(m_ranks)も書き換えます。
+     */
+    void insertionSort();
+
+    std::vector<Entry> m_entries{};
+    /**
+     * @brief オブジェクトごとの、並びの中の位置です。m_entries[m_ranks[i]].index == i になります。
+     */
+    std::vector<uint32_t> m_ranks{};
+    SweepAxis m_axis = SweepAxis::EAST;
+    size_t m_last_swaps = 0;
+};
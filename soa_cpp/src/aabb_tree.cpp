@@ -0,0 +1,357 @@
+#include "aabb_tree.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+PlaneBox unite(const PlaneBox &a, const PlaneBox &b) {
+    return PlaneBox{std::min(a.min_e, b.min_e), std::min(a.min_n, b.min_n), std::max(a.max_e, b.max_e),
+                    std::max(a.max_n, b.max_n)};
+}
+
+/**
+ * @brief 長方形の周長です。挿入先を選ぶときの「大きさ」の目安に使います(平面なので面積の代わりに周長を使います)。
+ */
+double perimeter(const PlaneBox &box) {
+    return 2.0 * ((box.max_e - box.min_e) + (box.max_n - box.min_n));
+}
+
+bool contains(const PlaneBox &box, const PlanePoint &point) {
+    return box.min_e <= point.e && point.e <= box.max_e && box.min_n <= point.n && point.n <= box.max_n;
+}
+
+bool sameBox(const PlaneBox &a, const PlaneBox &b) {
+    return a.min_e == b.min_e && a.min_n == b.min_n && a.max_e == b.max_e && a.max_n == b.max_n;
+}
+
+} // namespace
+
+PlanePoint planePoint(const SoaStorage &storage, size_t index) {
+    if (storage.coordinate_mode == CoordinateMode::ENU_F32) {
+        return PlanePoint{static_cast<double>(storage.enu_es[index]), static_cast<double>(storage.enu_ns[index])};
+    }
+    const LocalFrame &frame = storage.frame;
+    double dx = storage.ecef_xs[index] - frame.origin.x;
+    double dy = storage.ecef_ys[index] - frame.origin.y;
+    double dz = storage.ecef_zs[index] - frame.origin.z;
+    return PlanePoint{frame.east.x * dx + frame.east.y * dy + frame.east.z * dz,
+                      frame.north.x * dx + frame.north.y * dy + frame.north.z * dz};
+}
+
+void DynamicAabbTree::build(const SoaStorage &storage, double margin) {
+    size_t count = storage.object_handles.size();
+    m_margin = margin;
+    m_last_reinserts = 0;
+    m_root = -1;
+    m_free = -1;
+    m_nodes.clear();
+    // 葉がn個の二分木の節は2n-1個なので、最初に確保しておけば以降は空きリストの使い回しだけで済みます。
+    m_nodes.reserve(count * 2);
+    m_leaves.assign(count, -1);
+    m_points.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        int leaf = allocateNode();
+        Node &node = m_nodes[static_cast<size_t>(leaf)];
+        m_points[i] = planePoint(storage, i);
+        node.box = fattenedBox(m_points[i]);
+        node.object = static_cast<int>(i);
+        m_leaves[i] = leaf;
+        insertLeaf(leaf);
+    }
+    m_stack.reserve(static_cast<size_t>(std::max(height(), 0)) + 64);
+}
+
+void DynamicAabbTree::update(const SoaStorage &storage, const size_t *indices, size_t count) {
+    m_last_reinserts = 0;
+    for (size_t k = 0; k < count; ++k) {
+        size_t index = indices[k];
+        PlanePoint point = planePoint(storage, index);
+        m_points[index] = point;
+        int leaf = m_leaves[index];
+        // ほとんどのオブジェクトは太らせた長方形の中を動いているだけなので、比較だけで次へ進みます。
+        if (contains(m_nodes[static_cast<size_t>(leaf)].box, point)) {
+            continue;
+        }
+        removeLeaf(leaf);
+        m_nodes[static_cast<size_t>(leaf)].box = fattenedBox(point);
+        insertLeaf(leaf);
+        ++m_last_reinserts;
+    }
+    // 探索用の作業配列は木の高さ+1あれば足ります。木が深くなったときだけ広げます。
+    size_t needed = static_cast<size_t>(std::max(height(), 0)) + 2;
+    if (m_stack.capacity() < needed) {
+        m_stack.reserve(needed * 2);
+    }
+}
+
+void DynamicAabbTree::verify(const SoaStorage &storage) const {
+    size_t count = storage.object_handles.size();
+    if (m_leaves.size() != count || m_points.size() != count) {
+        throw std::runtime_error("aabb tree: object count mismatch");
+    }
+    for (size_t i = 0; i < count; ++i) {
+        PlanePoint point = planePoint(storage, i);
+        if (point.e != m_points[i].e || point.n != m_points[i].n) {
+            throw std::runtime_error("aabb tree: stale position for object " + storage.objectId(i));
+        }
+        const Node &leaf = m_nodes[static_cast<size_t>(m_leaves[i])];
+        if (!leaf.isLeaf() || leaf.object != static_cast<int>(i) || !contains(leaf.box, point)) {
+            throw std::runtime_error("aabb tree: object " + storage.objectId(i) + " is outside its leaf");
+        }
+    }
+    if (m_root == -1) {
+        if (count != 0) {
+            throw std::runtime_error("aabb tree: empty tree");
+        }
+        return;
+    }
+    if (m_nodes[static_cast<size_t>(m_root)].parent != -1) {
+        throw std::runtime_error("aabb tree: root has a parent");
+    }
+    // 根から全節をたどり、葉の数と、各節の長方形・高さ・親子のつながりを確かめます。
+    size_t leaves = 0;
+    std::vector<int> stack{m_root};
+    while (!stack.empty()) {
+        int node_index = stack.back();
+        stack.pop_back();
+        const Node &node = m_nodes[static_cast<size_t>(node_index)];
+        if (node.isLeaf()) {
+            if (node.height != 0 || m_leaves[static_cast<size_t>(node.object)] != node_index) {
+                throw std::runtime_error("aabb tree: broken leaf " + std::to_string(node_index));
+            }
+            ++leaves;
+            continue;
+        }
+        const Node &child1 = m_nodes[static_cast<size_t>(node.child1)];
+        const Node &child2 = m_nodes[static_cast<size_t>(node.child2)];
+        if (child1.parent != node_index || child2.parent != node_index) {
+            throw std::runtime_error("aabb tree: broken parent link at " + std::to_string(node_index));
+        }
+        if (node.height != 1 + std::max(child1.height, child2.height) || !sameBox(node.box, unite(child1.box, child2.box))) {
+            throw std::runtime_error("aabb tree: stale bounds at " + std::to_string(node_index));
+        }
+        if (leaves + stack.size() > count) {
+            throw std::runtime_error("aabb tree: cycle detected");
+        }
+        stack.push_back(node.child1);
+        stack.push_back(node.child2);
+    }
+    if (leaves != count) {
+        throw std::runtime_error("aabb tree: leaf count mismatch");
+    }
+}
+
+int DynamicAabbTree::allocateNode() {
+    if (m_free != -1) {
+        int node_index = m_free;
+        m_free = m_nodes[static_cast<size_t>(node_index)].parent;
+        m_nodes[static_cast<size_t>(node_index)] = Node{};
+        return node_index;
+    }
+    m_nodes.push_back(Node{});
+    return static_cast<int>(m_nodes.size() - 1);
+}
+
+void DynamicAabbTree::freeNode(int node_index) {
+    Node &node = m_nodes[static_cast<size_t>(node_index)];
+    node = Node{};
+    node.parent = m_free;
+    m_free = node_index;
+}
+
+void DynamicAabbTree::insertLeaf(int leaf) {
+    if (m_root == -1) {
+        m_root = leaf;
+        m_nodes[static_cast<size_t>(leaf)].parent = -1;
+        return;
+    }
+
+    // 根から下りながら、「ここで兄弟にする」費用と「子のどちらかへ進む」費用を比べ、安いほうを選びます。
+    // 費用は囲む長方形の周長で、下りた先の節より上の節も一緒に広がる分(inheritance)を足して比べます。
+    PlaneBox leaf_box = m_nodes[static_cast<size_t>(leaf)].box;
+    int index = m_root;
+    while (!m_nodes[static_cast<size_t>(index)].isLeaf()) {
+        const Node &node = m_nodes[static_cast<size_t>(index)];
+        double area = perimeter(node.box);
+        double combined_area = perimeter(unite(node.box, leaf_box));
+        double cost = 2.0 * combined_area;
+        double inheritance = 2.0 * (combined_area - area);
+
+        auto descendCost = [&](int child_index) {
+            const Node &child = m_nodes[static_cast<size_t>(child_index)];
+            double enlarged = perimeter(unite(leaf_box, child.box));
+            return child.isLeaf() ? enlarged + inheritance : (enlarged - perimeter(child.box)) + inheritance;
+        };
+        double cost1 = descendCost(node.child1);
+        double cost2 = descendCost(node.child2);
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+        index = (cost1 < cost2) ? node.child1 : node.child2;
+    }
+
+    // 選んだ節(sibling)と新しい葉を子に持つ親の節を作り、siblingがいた場所へ置きます。
+    int sibling = index;
+    int old_parent = m_nodes[static_cast<size_t>(sibling)].parent;
+    int new_parent = allocateNode();
+    Node &parent = m_nodes[static_cast<size_t>(new_parent)];
+    parent.parent = old_parent;
+    parent.box = unite(leaf_box, m_nodes[static_cast<size_t>(sibling)].box);
+    parent.height = m_nodes[static_cast<size_t>(sibling)].height + 1;
+    parent.child1 = sibling;
+    parent.child2 = leaf;
+    if (old_parent != -1) {
+        Node &grand = m_nodes[static_cast<size_t>(old_parent)];
+        if (grand.child1 == sibling) {
+            grand.child1 = new_parent;
+        } else {
+            grand.child2 = new_parent;
+        }
+    } else {
+        m_root = new_parent;
+    }
+    m_nodes[static_cast<size_t>(sibling)].parent = new_parent;
+    m_nodes[static_cast<size_t>(leaf)].parent = new_parent;
+
+    refitUpward(m_nodes[static_cast<size_t>(leaf)].parent);
+}
+
+void DynamicAabbTree::removeLeaf(int leaf) {
+    if (leaf == m_root) {
+        m_root = -1;
+        return;
+    }
+    // 親の節を外し、兄弟の節を祖父の子として直接つなぎます。
+    int parent = m_nodes[static_cast<size_t>(leaf)].parent;
+    const Node &parent_node = m_nodes[static_cast<size_t>(parent)];
+    int grand = parent_node.parent;
+    int sibling = (parent_node.child1 == leaf) ? parent_node.child2 : parent_node.child1;
+    m_nodes[static_cast<size_t>(leaf)].parent = -1;
+    if (grand != -1) {
+        Node &grand_node = m_nodes[static_cast<size_t>(grand)];
+        if (grand_node.child1 == parent) {
+            grand_node.child1 = sibling;
+        } else {
+            grand_node.child2 = sibling;
+        }
+        m_nodes[static_cast<size_t>(sibling)].parent = grand;
+        freeNode(parent);
+        refitUpward(grand);
+    } else {
+        m_root = sibling;
+        m_nodes[static_cast<size_t>(sibling)].parent = -1;
+        freeNode(parent);
+    }
+}
+
+void DynamicAabbTree::refitUpward(int node_index) {
+    int index = node_index;
+    while (index != -1) {
+        index = balance(index);
+        Node &node = m_nodes[static_cast<size_t>(index)];
+        const Node &child1 = m_nodes[static_cast<size_t>(node.child1)];
+        const Node &child2 = m_nodes[static_cast<size_t>(node.child2)];
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.box = unite(child1.box, child2.box);
+        index = node.parent;
+    }
+}
+
+int DynamicAabbTree::balance(int node_index) {
+    int ia = node_index;
+    Node &a = m_nodes[static_cast<size_t>(ia)];
+    if (a.isLeaf() || a.height < 2) {
+        return ia;
+    }
+    int ib = a.child1;
+    int ic = a.child2;
+    Node &b = m_nodes[static_cast<size_t>(ib)];
+    Node &c = m_nodes[static_cast<size_t>(ic)];
+    int diff = c.height - b.height;
+
+    // 右の子(c)が2段以上高いときは、cを持ち上げてaをその子にします。
+    if (diff > 1) {
+        int i_f = c.child1;
+        int i_g = c.child2;
+        Node &f = m_nodes[static_cast<size_t>(i_f)];
+        Node &g = m_nodes[static_cast<size_t>(i_g)];
+        c.child1 = ia;
+        c.parent = a.parent;
+        a.parent = ic;
+        if (c.parent != -1) {
+            Node &up = m_nodes[static_cast<size_t>(c.parent)];
+            if (up.child1 == ia) {
+                up.child1 = ic;
+            } else {
+                up.child2 = ic;
+            }
+        } else {
+            m_root = ic;
+        }
+        // cの子のうち高いほうをcに残し、低いほうをaへ渡します。
+        if (f.height > g.height) {
+            c.child2 = i_f;
+            a.child2 = i_g;
+            g.parent = ia;
+            a.box = unite(b.box, g.box);
+            c.box = unite(a.box, f.box);
+            a.height = 1 + std::max(b.height, g.height);
+            c.height = 1 + std::max(a.height, f.height);
+        } else {
+            c.child2 = i_g;
+            a.child2 = i_f;
+            f.parent = ia;
+            a.box = unite(b.box, f.box);
+            c.box = unite(a.box, g.box);
+            a.height = 1 + std::max(b.height, f.height);
+            c.height = 1 + std::max(a.height, g.height);
+        }
+        return ic;
+    }
+
+    // 左の子(b)が2段以上高いときは、同じようにbを持ち上げます。
+    if (diff < -1) {
+        int i_d = b.child1;
+        int i_e = b.child2;
+        Node &d = m_nodes[static_cast<size_t>(i_d)];
+        Node &e = m_nodes[static_cast<size_t>(i_e)];
+        b.child1 = ia;
+        b.parent = a.parent;
+        a.parent = ib;
+        if (b.parent != -1) {
+            Node &up = m_nodes[static_cast<size_t>(b.parent)];
+            if (up.child1 == ia) {
+                up.child1 = ib;
+            } else {
+                up.child2 = ib;
+            }
+        } else {
+            m_root = ib;
+        }
+        if (d.height > e.height) {
+            b.child2 = i_d;
+            a.child1 = i_e;
+            e.parent = ia;
+            a.box = unite(c.box, e.box);
+            b.box = unite(a.box, d.box);
+            a.height = 1 + std::max(c.height, e.height);
+            b.height = 1 + std::max(a.height, d.height);
+        } else {
+            b.child2 = i_e;
+            a.child1 = i_d;
+            d.parent = ia;
+            a.box = unite(c.box, d.box);
+            b.box = unite(a.box, e.box);
+            a.height = 1 + std::max(c.height, d.height);
+            b.height = 1 + std::max(a.height, e.height);
+        }
+        return ib;
+    }
+    return ia;
+}
+
+PlaneBox DynamicAabbTree::fattenedBox(const PlanePoint &point) const {
+    return PlaneBox{point.e - m_margin, point.n - m_margin, point.e + m_margin, point.n + m_margin};
+}
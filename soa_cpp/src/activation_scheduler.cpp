@@ -0,0 +1,61 @@
+#include "activation_scheduler.hpp"
+
+#include <iterator>
+
+void ActivationScheduler::clear() {
+    m_pending.clear();
+    m_next_pending = 0;
+    m_active.clear();
+    m_merge_scratch.clear();
+}
+
+void ActivationScheduler::add(size_t index, int start_sec) {
+    m_pending.push_back(PendingEntry{start_sec, index});
+}
+
+void ActivationScheduler::rewind() {
+    // 開始時刻の早い順に並べておけば、毎秒は待機列の先頭だけを見れば済みます。
+    std::sort(m_pending.begin(), m_pending.end(), [](const PendingEntry &a, const PendingEntry &b) {
+        if (a.start_sec != b.start_sec) {
+            return a.start_sec < b.start_sec;
+        }
+        return a.index < b.index;
+    });
+    m_next_pending = 0;
+    m_active.clear();
+    m_active.reserve(m_pending.size());
+    // マージの書き出し先も同じ大きさで確保しておき、activateでヒープ確保が起きないようにします。
+    m_merge_scratch.clear();
+    m_merge_scratch.reserve(m_pending.size());
+}
+
+void ActivationScheduler::activate(int time_sec) {
+    // 開始時刻を迎えたものを末尾に追加し、添字の昇順になるように既存の一覧とマージします。
+    size_t previous_size = m_active.size();
+    while (m_next_pending < m_pending.size() && m_pending[m_next_pending].start_sec <= time_sec) {
+        m_active.push_back(m_pending[m_next_pending].index);
+        ++m_next_pending;
+    }
+    if (m_active.size() == previous_size) {
+        return;
+    }
+    auto middle = m_active.begin() + static_cast<std::ptrdiff_t>(previous_size);
+    std::sort(middle, m_active.end());
+    // std::inplace_mergeは作業用の領域をoperator newで確保するため、rewindで確保済みの配列へマージして入れ替えます。
+    // 入れ替えたあとも両方の容量は全件分あるので、次のactivateでも確保は起きません。
+    m_merge_scratch.clear();
+    std::merge(m_active.begin(), middle, middle, m_active.end(), std::back_inserter(m_merge_scratch));
+    m_active.swap(m_merge_scratch);
+}
+
+void ActivationScheduler::remap(const std::vector<uint32_t> &new_indices) {
+    // 待機列は開始時刻で並んでいるので、添字を書き換えても順番は崩れません。
+    // 同じ開始時刻のものの並びが変わっても、activateで移動中リストを並べ直すため結果は同じです。
+    for (PendingEntry &entry : m_pending) {
+        entry.index = new_indices[entry.index];
+    }
+    for (size_t &index : m_active) {
+        index = new_indices[index];
+    }
+    std::sort(m_active.begin(), m_active.end());
+}
@@ -0,0 +1,30 @@
+#include "broadphase.hpp"
+
+#include <cstdlib>
+#include <string>
+
+Broadphase selectBroadphase() {
+    const char *requested = std::getenv("SOA_BROADPHASE");
+    if (requested == nullptr) {
+        return Broadphase::GRID;
+    }
+    std::string name(requested);
+    for (Broadphase broadphase : {Broadphase::SWEEP_AND_PRUNE, Broadphase::DYNAMIC_BVH}) {
+        if (name == broadphaseName(broadphase)) {
+            return broadphase;
+        }
+    }
+    return Broadphase::GRID;
+}
+
+const char *broadphaseName(Broadphase broadphase) {
+    switch (broadphase) {
+    case Broadphase::GRID:
+        return "grid";
+    case Broadphase::SWEEP_AND_PRUNE:
+        return "sap";
+    case Broadphase::DYNAMIC_BVH:
+        return "bvh";
+    }
+    return "unknown";
+}
@@ -0,0 +1,192 @@
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "CLI/CLI11.hpp"
+#include "broadphase.hpp"
+#include "nlohmann/json.hpp"
+#include "soa_simulation.hpp"
+#include "spdlog/spdlog.h"
+
+/**
+ * @brief CLI引数の受け取り先をまとめる構造体です。
+ */
+struct Args {
+    std::string out_dir = ".";
+    int objects = 2000;
+    int seconds = 600;
+};
+
+/**
+ * @brief 1つの近傍探索方式の計測結果です。
+ */
+struct BenchResult {
+    Broadphase broadphase = Broadphase::GRID;
+    double step_ms = 0.0;
+    size_t mismatched_secs = 0;
+};
+
+namespace {
+
+nlohmann::json makePoint(double lat_deg, double lon_deg, double speeds_kph) {
+    return nlohmann::json{{"lat_deg", lat_deg}, {"lon_deg", lon_deg}, {"alt_m", 0.0}, {"speeds_kph", speeds_kph}};
+}
+
+/**
+ * @brief 計測用のシナリオを書き出します。
+ *
+ * @details uniformは約200km四方に一様に散らばり、clusteredは9割が3か所の港の入口(約6km四方)に集まり、
+ *          残りが約200km四方にまばらに散らばります。探知距離(3km)は港の広さより小さくしてあり、
+ *          港の中では「近くにいるが探知範囲の外」の相手を近傍探索でどれだけ省けるかが速さに効きます。
+ *          乱数の種は固定なので、毎回同じシナリオになります。
+ */
+std::string writeScenario(const std::string &path, int objects, bool clustered) {
+    std::mt19937 rng(clustered ? 20240611u : 20240610u);
+    std::uniform_real_distribution<double> wide_lat(33.0, 34.8);
+    std::uniform_real_distribution<double> wide_lon(129.0, 131.2);
+    std::uniform_real_distribution<double> near(-0.03, 0.03);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    const double harbours[3][2] = {{33.6, 130.4}, {33.9, 130.9}, {34.0, 129.8}};
+
+    nlohmann::json teams = nlohmann::json::array();
+    for (int t = 0; t < 2; ++t) {
+        nlohmann::json team_objects = nlohmann::json::array();
+        for (int k = 0; k < objects / 2; ++k) {
+            double lat0 = 0.0;
+            double lon0 = 0.0;
+            double lat1 = 0.0;
+            double lon1 = 0.0;
+            if (clustered && unit(rng) < 0.9) {
+                // 港の入口の周りを行き来します。
+                const double *harbour = harbours[k % 3];
+                lat0 = harbour[0] + near(rng);
+                lon0 = harbour[1] + near(rng);
+                lat1 = harbour[0] + near(rng);
+                lon1 = harbour[1] + near(rng);
+            } else {
+                lat0 = wide_lat(rng);
+                lon0 = wide_lon(rng);
+                lat1 = wide_lat(rng);
+                lon1 = wide_lon(rng);
+            }
+            std::string id = std::string(t == 0 ? "A" : "B") + "_" + std::to_string(k);
+            double speed_kph = 20.0 + 180.0 * unit(rng);
+            team_objects.push_back(nlohmann::json{
+                {"id", id},
+                {"role", k % 3 == 0 ? "scout" : "messenger"},
+                {"start_sec", static_cast<int>(unit(rng) * 60.0)},
+                {"route", {makePoint(lat0, lon0, speed_kph), makePoint(lat1, lon1, speed_kph)}},
+            });
+        }
+        teams.push_back(nlohmann::json{
+            {"id", t == 0 ? "A" : "B"}, {"name", t == 0 ? "Alpha Team" : "Bravo Team"}, {"objects", team_objects}});
+    }
+
+    nlohmann::json scenario{
+        {"performance",
+         {{"scout", {{"comm_range_m", 2000}, {"detect_range_m", 3000}}},
+          {"messenger", {{"comm_range_m", 8000}}},
+          {"attacker", {{"bom_range_m", 1000}}}}},
+        {"teams", teams},
+    };
+    std::ofstream out(path);
+    if (!out) {
+        throw std::runtime_error("broadphase_bench: failed to open " + path);
+    }
+    out << scenario.dump();
+    return path;
+}
+
+/**
+ * @brief 2つのシミュレーションの探知状態が、シナリオの順番で見てすべて同じかを返します。
+ */
+bool sameDetectionStates(const SoaSimulation &reference, const SoaSimulation &candidate) {
+    const SoaStorage &ref_storage = reference.storage();
+    const SoaStorage &cand_storage = candidate.storage();
+    for (size_t k = 0; k < ref_storage.scenario_order.size(); ++k) {
+        uint32_t ref_index = ref_storage.scenario_order[k];
+        uint32_t cand_index = cand_storage.scenario_order[k];
+        if (ref_storage.detect_states[ref_index].targets != cand_storage.detect_states[cand_index].targets) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 1つのシナリオを全方式で1秒ずつ交互に進め、方式ごとのstep時間と、GRID方式との食い違いを集計します。
+ */
+std::vector<BenchResult> runScenario(const std::string &scenario_path, const std::string &prefix, int seconds) {
+    std::vector<BenchResult> results;
+    std::vector<std::unique_ptr<SoaSimulation>> simulations;
+    for (Broadphase broadphase : {Broadphase::GRID, Broadphase::SWEEP_AND_PRUNE, Broadphase::DYNAMIC_BVH}) {
+        BenchResult result;
+        result.broadphase = broadphase;
+        results.push_back(result);
+        auto simulation = std::make_unique<SoaSimulation>();
+        simulation->setBroadphase(broadphase);
+        simulation->setDetectionBackend(DetectionBackend::SORTED_VECTOR);
+        std::string name = prefix + "_" + broadphaseName(broadphase);
+        simulation->initialize(scenario_path, name + "_timeline.ndjson", name + "_event.ndjson");
+        simulations.push_back(std::move(simulation));
+    }
+
+    using Clock = std::chrono::steady_clock;
+    for (int time_sec = 0; time_sec <= seconds; ++time_sec) {
+        for (size_t k = 0; k < simulations.size(); ++k) {
+            auto t0 = Clock::now();
+            simulations[k]->step(time_sec);
+            auto t1 = Clock::now();
+            results[k].step_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+        }
+        for (size_t k = 1; k < simulations.size(); ++k) {
+            if (!sameDetectionStates(*simulations[0], *simulations[k])) {
+                ++results[k].mismatched_secs;
+            }
+        }
+    }
+    return results;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    // 一様なシナリオと、港の入口に密集したシナリオを生成し、
+    // 空間格子・スイープ・動的AABB木の3方式を同じ時刻で交互に進めて、step時間と結果の一致を報告する計測用のツールです。
+    CLI::App app{"SoA C++ broadphase benchmark"};
+    try {
+        Args args;
+        app.add_option("--out-dir", args.out_dir, "生成したシナリオとログを書き出すディレクトリ");
+        app.add_option("--objects", args.objects, "シナリオのオブジェクト数");
+        app.add_option("--seconds", args.seconds, "進める秒数");
+        app.parse(argc, argv);
+
+        std::cout << "objects " << args.objects << ", seconds " << args.seconds << "\n";
+        std::cout << "scenario    broadphase  step_ms     mismatched_secs(vs grid)\n";
+        for (bool clustered : {false, true}) {
+            std::string name = clustered ? "clustered" : "uniform";
+            std::string prefix = args.out_dir + "/broadphase_bench_" + name;
+            std::string scenario_path = writeScenario(prefix + "_scenario.json", args.objects, clustered);
+            std::vector<BenchResult> results = runScenario(scenario_path, prefix, args.seconds);
+            for (const auto &result : results) {
+                std::cout << std::left << std::setw(12) << name << std::setw(12) << broadphaseName(result.broadphase)
+                          << std::setw(12) << std::fixed << std::setprecision(1) << result.step_ms
+                          << result.mismatched_secs << "\n";
+            }
+        }
+        spdlog::shutdown();
+    } catch (const CLI::ParseError &error) {
+        return app.exit(error);
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "CLI/CLI11.hpp"
+#include "geo.hpp"
+#include "local_frame.hpp"
+#include "nlohmann/json.hpp"
+#include "soa_simulation.hpp"
+#include "spdlog/spdlog.h"
+
+/**
+ * @brief CLI引数の受け取り先をまとめる構造体です。
+ */
+struct Args {
+    std::string scenario_path;
+    std::string out_dir = ".";
+};
+
+/**
+ * @brief 2つの座標系の位置の差を集計する構造体です。
+ */
+struct PositionError {
+    double max_distance_m = 0.0;
+    double sum_squared_m = 0.0;
+    size_t samples = 0;
+    double max_lat_deg = 0.0;
+    double max_lon_deg = 0.0;
+    double max_alt_m = 0.0;
+    int max_time_sec = 0;
+};
+
+/**
+ * @brief イベントを突き合わせるためのキー(時刻・種別・動作・発生元・相手)です。
+ */
+using EventKey = std::tuple<int, std::string, std::string, std::string, std::string>;
+
+namespace {
+
+/**
+ * @brief イベントログを読み込み、キーごとのイベント一覧にまとめます。
+ */
+std::multimap<EventKey, nlohmann::json> loadEvents(const std::string &path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("coord_report: failed to open " + path);
+    }
+    std::multimap<EventKey, nlohmann::json> events;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        nlohmann::json event = nlohmann::json::parse(line);
+        EventKey key{
+            event.value("time_sec", 0),
+            event.value("event_type", std::string()),
+            event.value("detection_action", std::string()),
+            event.value("scount_id", event.value("attacker_id", std::string())),
+            event.value("detect_id", std::string()),
+        };
+        events.emplace(std::move(key), std::move(event));
+    }
+    return events;
+}
+
+/**
+ * @brief 同じ時刻で位置を進めた2つのシミュレーションの位置の差を集計します。
+ */
+void accumulatePositionError(const SoaSimulation &reference,
+                             const SoaSimulation &candidate,
+                             int time_sec,
+                             PositionError &error) {
+    // 並べ替えを有効にしていると2つのシミュレーションで配列の順番が違うため、シナリオの順番で対応を取ります。
+    const std::vector<uint32_t> &ref_order = reference.storage().scenario_order;
+    const std::vector<uint32_t> &cand_order = candidate.storage().scenario_order;
+    for (size_t k = 0; k < ref_order.size(); ++k) {
+        Ecef ref_pos = reference.objectPosition(ref_order[k]);
+        Ecef cand_pos = candidate.objectPosition(cand_order[k]);
+        double distance = distanceEcef(ref_pos, cand_pos);
+        error.sum_squared_m += distance * distance;
+        ++error.samples;
+        if (distance > error.max_distance_m) {
+            error.max_distance_m = distance;
+            error.max_time_sec = time_sec;
+        }
+        double ref_lat = 0.0;
+        double ref_lon = 0.0;
+        double ref_alt = 0.0;
+        double cand_lat = 0.0;
+        double cand_lon = 0.0;
+        double cand_alt = 0.0;
+        ecefToGeodetic(ref_pos, ref_lat, ref_lon, ref_alt);
+        ecefToGeodetic(cand_pos, cand_lat, cand_lon, cand_alt);
+        error.max_lat_deg = std::max(error.max_lat_deg, std::abs(ref_lat - cand_lat));
+        error.max_lon_deg = std::max(error.max_lon_deg, std::abs(ref_lon - cand_lon));
+        error.max_alt_m = std::max(error.max_alt_m, std::abs(ref_alt - cand_alt));
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    // ECEF(double)とENU(float)の2つのシミュレーションを1秒ずつ交互に進め、
+    // 同じ時刻の位置の差と、出力されたイベントの差を報告する精度検証用のツールです。
+    CLI::App app{"SoA C++ coordinate mode accuracy report"};
+    try {
+        Args args;
+        app.add_option("--scenario", args.scenario_path, "シナリオJSONのパス")->required();
+        app.add_option("--out-dir", args.out_dir, "比較用のログを書き出すディレクトリ");
+        app.parse(argc, argv);
+
+        std::string ecef_prefix = args.out_dir + "/coord_report_ecef";
+        std::string enu_prefix = args.out_dir + "/coord_report_enu32";
+        PositionError error;
+        double ecef_step_ms = 0.0;
+        double enu_step_ms = 0.0;
+        {
+            SoaSimulation reference;
+            reference.setCoordinateMode(CoordinateMode::ECEF_F64);
+            reference.initialize(args.scenario_path, ecef_prefix + "_timeline.ndjson", ecef_prefix + "_event.ndjson");
+            SoaSimulation candidate;
+            candidate.setCoordinateMode(CoordinateMode::ENU_F32);
+            candidate.initialize(args.scenario_path, enu_prefix + "_timeline.ndjson", enu_prefix + "_event.ndjson");
+
+            const LocalFrame &frame = candidate.storage().frame;
+            double origin_lat = 0.0;
+            double origin_lon = 0.0;
+            double origin_alt = 0.0;
+            ecefToGeodetic(frame.origin, origin_lat, origin_lon, origin_alt);
+            std::cout << "local frame origin: lat " << origin_lat << " deg, lon " << origin_lon << " deg\n";
+
+            using Clock = std::chrono::steady_clock;
+            for (int time_sec = 0; time_sec <= 24 * 60 * 60; ++time_sec) {
+                auto t0 = Clock::now();
+                reference.step(time_sec);
+                auto t1 = Clock::now();
+                candidate.step(time_sec);
+                auto t2 = Clock::now();
+                ecef_step_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+                enu_step_ms += std::chrono::duration<double, std::milli>(t2 - t1).count();
+                accumulatePositionError(reference, candidate, time_sec, error);
+            }
+        }
+
+        std::cout << "position error (enu32 vs ecef):\n"
+                  << "  max distance  " << error.max_distance_m << " m (time_sec " << error.max_time_sec << ")\n"
+                  << "  rms distance  " << std::sqrt(error.sum_squared_m / static_cast<double>(std::max<size_t>(error.samples, 1)))
+                  << " m\n"
+                  << "  max |dlat|    " << error.max_lat_deg << " deg\n"
+                  << "  max |dlon|    " << error.max_lon_deg << " deg\n"
+                  << "  max |dalt|    " << error.max_alt_m << " m\n";
+        std::cout << "step time (position/detection/detonation, timeline excluded):\n"
+                  << "  ecef " << ecef_step_ms << " ms\n"
+                  << "  enu32 " << enu_step_ms << " ms\n";
+
+        // イベントログは非同期で書かれるため、スレッドプールを止めて書き切ってから突き合わせます。
+        spdlog::shutdown();
+        auto ecef_events = loadEvents(ecef_prefix + "_event.ndjson");
+        auto enu_events = loadEvents(enu_prefix + "_event.ndjson");
+        size_t ecef_count = ecef_events.size();
+        size_t matched = 0;
+        int max_distance_diff_m = 0;
+        std::vector<nlohmann::json> only_ecef;
+        for (const auto &entry : ecef_events) {
+            auto it = enu_events.find(entry.first);
+            if (it == enu_events.end()) {
+                only_ecef.push_back(entry.second);
+                continue;
+            }
+            ++matched;
+            if (entry.second.contains("distance_m")) {
+                int diff = std::abs(entry.second["distance_m"].get<int>() - it->second["distance_m"].get<int>());
+                max_distance_diff_m = std::max(max_distance_diff_m, diff);
+            }
+            enu_events.erase(it);
+        }
+        std::cout << "events:\n"
+                  << "  ecef " << ecef_count << ", matched " << matched << "\n"
+                  << "  only in ecef  " << only_ecef.size() << "\n"
+                  << "  only in enu32 " << enu_events.size() << "\n"
+                  << "  max |distance_m diff| " << max_distance_diff_m << "\n";
+        // 境界付近で時刻がずれたイベントは、ここで個別に確認できます。
+        for (const auto &event : only_ecef) {
+            std::cout << "  ecef only:  " << event.dump() << "\n";
+        }
+        for (const auto &entry : enu_events) {
+            std::cout << "  enu32 only: " << entry.second.dump() << "\n";
+        }
+    } catch (const CLI::ParseError &error) {
+        return app.exit(error);
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include "detection_bitmatrix.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+DetectionBackend selectDetectionBackend() {
+    const char *requested = std::getenv("SOA_DETECTION_STATE");
+    if (requested == nullptr) {
+        return DetectionBackend::SORTED_VECTOR;
+    }
+    std::string name(requested);
+    if (name == detectionBackendName(DetectionBackend::BITMATRIX)) {
+        return DetectionBackend::BITMATRIX;
+    }
+    return DetectionBackend::SORTED_VECTOR;
+}
+
+const char *detectionBackendName(DetectionBackend backend) {
+    switch (backend) {
+    case DetectionBackend::SORTED_VECTOR:
+        return "sorted";
+    case DetectionBackend::BITMATRIX:
+        return "bitmatrix";
+    }
+    return "unknown";
+}
+
+void DetectionBitmatrix::reset(size_t row_count) {
+    m_rows.clear();
+    m_rows.resize(row_count);
+}
+
+void DetectionBitmatrix::permuteRows(const std::vector<uint32_t> &order) {
+    if (m_rows.size() != order.size()) {
+        return;
+    }
+    // 行の中身はvectorなので、moveで付け替えるだけでブロックはコピーしません。
+    std::vector<std::vector<Block>> rows;
+    rows.reserve(order.size());
+    for (uint32_t old_row : order) {
+        rows.push_back(std::move(m_rows[old_row]));
+    }
+    m_rows.swap(rows);
+}
+
+void DetectionBitmatrix::beginRow(size_t row) {
+    for (Block &block : m_rows[row]) {
+        block.prev = block.curr;
+        block.curr = 0;
+        block.prev_payloads.swap(block.curr_payloads);
+        block.curr_payloads.clear();
+    }
+}
+
+bool DetectionBitmatrix::set(size_t row, uint32_t target, const ContactPayload &payload) {
+    // 行のブロックはwordの昇順なので、二分探索で目的のブロックを探します。
+    std::vector<Block> &blocks = m_rows[row];
+    uint32_t word = target / 64u;
+    auto it = std::lower_bound(blocks.begin(), blocks.end(), word, [](const Block &block, uint32_t value) {
+        return block.word < value;
+    });
+    if (it == blocks.end() || it->word != word) {
+        Block block;
+        block.word = word;
+        it = blocks.insert(it, std::move(block));
+    }
+
+    int bit = static_cast<int>(target % 64u);
+    uint64_t mask = uint64_t{1} << bit;
+    if ((it->curr & mask) != 0) {
+        return false;
+    }
+    // 詰めた配列の並びがビット位置の昇順になるよう、下に立っているビットの数の位置へ差し込みます。
+    size_t rank = rankBelow(it->curr, bit);
+    it->curr_payloads.insert(it->curr_payloads.begin() + static_cast<std::ptrdiff_t>(rank), payload);
+    it->curr |= mask;
+    return true;
+}
+
+void DetectionBitmatrix::endRow(size_t row) {
+    std::vector<Block> &blocks = m_rows[row];
+    blocks.erase(std::remove_if(blocks.begin(), blocks.end(), [](const Block &block) { return block.curr == 0; }),
+                 blocks.end());
+}
+
+bool DetectionBitmatrix::contains(size_t row, uint32_t target) const {
+    const std::vector<Block> &blocks = m_rows[row];
+    uint32_t word = target / 64u;
+    auto it = std::lower_bound(blocks.begin(), blocks.end(), word, [](const Block &block, uint32_t value) {
+        return block.word < value;
+    });
+    if (it == blocks.end() || it->word != word) {
+        return false;
+    }
+    return (it->curr & (uint64_t{1} << (target % 64u))) != 0;
+}
+
+size_t DetectionBitmatrix::blockCount() const {
+    size_t count = 0;
+    for (const auto &blocks : m_rows) {
+        count += blocks.size();
+    }
+    return count;
+}
+
+size_t DetectionBitmatrix::payloadCount() const {
+    size_t count = 0;
+    for (const auto &blocks : m_rows) {
+        for (const Block &block : blocks) {
+            count += block.prev_payloads.size() + block.curr_payloads.size();
+        }
+    }
+    return count;
+}
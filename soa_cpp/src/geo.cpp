@@ -1,6 +1,8 @@
 #include "geo.hpp"
 
 #include <cmath>
+#include <cstdlib>
+#include <string>
 
 double distanceEcef(const Ecef &a, const Ecef &b) {
     // ECEF空間でのユークリッド距離を計算するために、3軸の差分を合成します。
@@ -35,12 +37,17 @@ Ecef geodeticToEcef(double lat_deg, double lon_deg, double alt_m) {
     };
 }
 
-void ecefToGeodetic(const Ecef &pos, double &lat_deg, double &lon_deg, double &alt_m) {
+namespace {
+
+constexpr double kWgs84A = 6378137.0;
+constexpr double kWgs84F = 1.0 / 298.257223563;
+constexpr double kWgs84E2 = kWgs84F * (2.0 - kWgs84F);
+
+void ecefToGeodeticIterative(const Ecef &pos, double &lat_deg, double &lon_deg, double &alt_m) {
     // ECEFから緯度経度高度へ戻すため、反復近似で緯度と高度を求めます。
     // 変換は純粋関数として扱い、状態を持たずに呼び出せる形にしています。
-    constexpr double a = 6378137.0;
-    constexpr double f = 1.0 / 298.257223563;
-    constexpr double e2 = f * (2.0 - f);
+    constexpr double a = kWgs84A;
+    constexpr double e2 = kWgs84E2;
 
     double p = std::sqrt(pos.x * pos.x + pos.y * pos.y);
     double lat = std::atan2(pos.z, p);
@@ -59,3 +66,116 @@ void ecefToGeodetic(const Ecef &pos, double &lat_deg, double &lon_deg, double &a
     lon_deg = lon * 180.0 / M_PI;
     alt_m = alt;
 }
+
+void ecefToGeodeticBowring(const Ecef &pos, double &lat_deg, double &lon_deg, double &alt_m) {
+    // Bowringの式です。楕円体の中心角(パラメトリック緯度)θを1回求め、そこから緯度を直接計算します。
+    // sinθ・cosθや緯度のsin・cosは、atan2に渡す2つの値を斜辺で割れば求まるため、sin/cosを呼ぶ必要がありません。
+    constexpr double a = kWgs84A;
+    constexpr double b = kWgs84A * (1.0 - kWgs84F);
+    constexpr double e2 = kWgs84E2;
+    constexpr double ep2 = e2 / (1.0 - e2);
+
+    double p = std::sqrt(pos.x * pos.x + pos.y * pos.y);
+    double za = pos.z * a;
+    double pb = p * b;
+    double r = std::sqrt(za * za + pb * pb);
+    if (r == 0.0) {
+        // 地球の中心は緯度が決まらないため、反復法と同じ値(緯度0・高度-a)にします。
+        lat_deg = 0.0;
+        lon_deg = std::atan2(pos.y, pos.x) * 180.0 / M_PI;
+        alt_m = -a;
+        return;
+    }
+    double sin_theta = za / r;
+    double cos_theta = pb / r;
+
+    double num = pos.z + ep2 * b * sin_theta * sin_theta * sin_theta;
+    double den = p - e2 * a * cos_theta * cos_theta * cos_theta;
+    double hyp = std::sqrt(num * num + den * den);
+    double sin_lat = num / hyp;
+    double cos_lat = den / hyp;
+    double lat = std::atan2(num, den);
+
+    // 高度は極の近くでも割り算で桁落ちしない形(p*cosφ + z*sinφ - a*√(1 - e²sin²φ))で求めます。
+    double alt = p * cos_lat + pos.z * sin_lat - a * std::sqrt(1.0 - e2 * sin_lat * sin_lat);
+
+    lat_deg = lat * 180.0 / M_PI;
+    lon_deg = std::atan2(pos.y, pos.x) * 180.0 / M_PI;
+    alt_m = alt;
+}
+
+void ecefToGeodeticVermeille(const Ecef &pos, double &lat_deg, double &lon_deg, double &alt_m) {
+    // Vermeille(2004)の閉じた式です。緯度を4次方程式の解として直接求めるため、反復がありません。
+    constexpr double a = kWgs84A;
+    constexpr double e2 = kWgs84E2;
+    constexpr double e4 = e2 * e2;
+
+    double xy2 = pos.x * pos.x + pos.y * pos.y;
+    double p = xy2 / (a * a);
+    double q = (1.0 - e2) / (a * a) * pos.z * pos.z;
+    double r = (p + q - e4) / 6.0;
+    double s = e4 * p * q / (4.0 * r * r * r);
+    double t = std::cbrt(1.0 + s + std::sqrt(s * (2.0 + s)));
+    double u = r * (1.0 + t + 1.0 / t);
+    double v = std::sqrt(u * u + e4 * q);
+    double w = e2 * (u + v - q) / (2.0 * v);
+    double k = std::sqrt(u + v + w * w) - w;
+    double d = k * std::sqrt(xy2) / (k + e2);
+    double dz = std::sqrt(d * d + pos.z * pos.z);
+
+    lat_deg = 2.0 * std::atan2(pos.z, d + dz) * 180.0 / M_PI;
+    lon_deg = std::atan2(pos.y, pos.x) * 180.0 / M_PI;
+    alt_m = (k + e2 - 1.0) / k * dz;
+}
+
+} // namespace
+
+GeodeticMethod selectGeodeticMethod() {
+    const char *requested = std::getenv("SOA_GEODETIC");
+    if (requested == nullptr) {
+        return GeodeticMethod::ITERATIVE;
+    }
+    std::string name(requested);
+    for (GeodeticMethod method : {GeodeticMethod::BOWRING, GeodeticMethod::VERMEILLE}) {
+        if (name == geodeticMethodName(method)) {
+            return method;
+        }
+    }
+    return GeodeticMethod::ITERATIVE;
+}
+
+const char *geodeticMethodName(GeodeticMethod method) {
+    switch (method) {
+    case GeodeticMethod::ITERATIVE:
+        return "iterative";
+    case GeodeticMethod::BOWRING:
+        return "bowring";
+    case GeodeticMethod::VERMEILLE:
+        return "vermeille";
+    }
+    return "unknown";
+}
+
+GeodeticMethod activeGeodeticMethod() {
+    // 環境変数は最初の1回だけ読みます。タイムラインでは毎秒オブジェクト数だけ呼ばれるため、毎回は読みません。
+    static const GeodeticMethod method = selectGeodeticMethod();
+    return method;
+}
+
+void ecefToGeodetic(const Ecef &pos, double &lat_deg, double &lon_deg, double &alt_m) {
+    ecefToGeodetic(activeGeodeticMethod(), pos, lat_deg, lon_deg, alt_m);
+}
+
+void ecefToGeodetic(GeodeticMethod method, const Ecef &pos, double &lat_deg, double &lon_deg, double &alt_m) {
+    switch (method) {
+    case GeodeticMethod::BOWRING:
+        ecefToGeodeticBowring(pos, lat_deg, lon_deg, alt_m);
+        return;
+    case GeodeticMethod::VERMEILLE:
+        ecefToGeodeticVermeille(pos, lat_deg, lon_deg, alt_m);
+        return;
+    case GeodeticMethod::ITERATIVE:
+        break;
+    }
+    ecefToGeodeticIterative(pos, lat_deg, lon_deg, alt_m);
+}
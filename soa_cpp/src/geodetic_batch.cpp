@@ -0,0 +1,303 @@
+#include "geodetic_batch.hpp"
+
+#include <cmath>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SOA_GEODETIC_BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+constexpr double kWgs84A = 6378137.0;
+constexpr double kWgs84F = 1.0 / 298.257223563;
+constexpr double kWgs84E2 = kWgs84F * (2.0 - kWgs84F);
+
+void ecefToGeodeticScalar(GeodeticMethod method,
+                          const double *xs,
+                          const double *ys,
+                          const double *zs,
+                          size_t begin,
+                          size_t count,
+                          double *lats_deg,
+                          double *lons_deg,
+                          double *alts_m) {
+    for (size_t i = begin; i < count; ++i) {
+        ecefToGeodetic(method, Ecef{xs[i], ys[i], zs[i]}, lats_deg[i], lons_deg[i], alts_m[i]);
+    }
+}
+
+void geodeticToEcefScalar(const double *lats_deg,
+                          const double *lons_deg,
+                          const double *alts_m,
+                          size_t begin,
+                          size_t count,
+                          double *xs,
+                          double *ys,
+                          double *zs) {
+    for (size_t i = begin; i < count; ++i) {
+        Ecef pos = geodeticToEcef(lats_deg[i], lons_deg[i], alts_m[i]);
+        xs[i] = pos.x;
+        ys[i] = pos.y;
+        zs[i] = pos.z;
+    }
+}
+
+#if defined(SOA_GEODETIC_BATCH_X86)
+// 多項式の係数はCephesライブラリのatan/sin/cosと同じです。
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kPiOver2 = 1.57079632679489661923;
+constexpr double kPiOver4 = 0.78539816339744830962;
+// π/2をdoubleで表したときに切り捨てられた下位の値です。足し戻して丸め誤差を減らします。
+constexpr double kMoreBits = 6.123233995736765886130e-17;
+
+/**
+ * @brief 多項式 ((((c0*x + c1)*x + c2)*x + ...) を4レーン同時に計算します(ホーナー法)。
+ */
+template <size_t N>
+__attribute__((target("avx2"))) __m256d polynomial(__m256d x, const double (&coefficients)[N]) {
+    __m256d result = _mm256_set1_pd(coefficients[0]);
+    for (size_t k = 1; k < N; ++k) {
+        result = _mm256_add_pd(_mm256_mul_pd(result, x), _mm256_set1_pd(coefficients[k]));
+    }
+    return result;
+}
+
+/**
+ * @brief atan2(y, x)を4レーン同時に求めます。
+ *
+ * @details |y|と|x|の小さいほうを大きいほうで割って[0, 1]の値にし、0.66を超えるときは(t - 1)/(t + 1)でさらに0付近へ寄せてから、
+ *          多項式の比でatanを近似します。最後に、割り算の向きと符号からπ/2やπとの差に直して4つの象限へ戻します。
+ *          分岐の代わりにblend(マスクでレーンごとに値を選ぶ命令)を使います。
+ */
+__attribute__((target("avx2"))) __m256d atan2Avx2(__m256d y, __m256d x) {
+    static const double kP[] = {-8.750608600031904122785e-1, -1.615753718733365076637e1, -7.500855792314704667340e1,
+                                -1.228866684490136173410e2, -6.485021904942025371773e1};
+    static const double kQ[] = {1.0, 2.485846490142306297962e1, 1.650270098316988542046e2, 4.328810604912902668951e2,
+                                4.853903996359136964868e2, 1.945506571482613964425e2};
+    const __m256d sign_bit = _mm256_set1_pd(-0.0);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one = _mm256_set1_pd(1.0);
+
+    __m256d ax = _mm256_andnot_pd(sign_bit, x);
+    __m256d ay = _mm256_andnot_pd(sign_bit, y);
+    __m256d hi = _mm256_max_pd(ax, ay);
+    __m256d lo = _mm256_min_pd(ax, ay);
+    // 両方0のレーンは0/0にならないよう、割る数を1にしておきます(結果は0)。
+    __m256d hi_zero = _mm256_cmp_pd(hi, zero, _CMP_EQ_OQ);
+    __m256d t = _mm256_div_pd(lo, _mm256_blendv_pd(hi, one, hi_zero));
+
+    __m256d big = _mm256_cmp_pd(t, _mm256_set1_pd(0.66), _CMP_GT_OQ);
+    __m256d u = _mm256_blendv_pd(t, _mm256_div_pd(_mm256_sub_pd(t, one), _mm256_add_pd(t, one)), big);
+    __m256d base = _mm256_and_pd(big, _mm256_set1_pd(kPiOver4));
+    __m256d extra = _mm256_and_pd(big, _mm256_set1_pd(0.5 * kMoreBits));
+    __m256d z = _mm256_mul_pd(u, u);
+    __m256d ratio = _mm256_div_pd(_mm256_mul_pd(z, polynomial(z, kP)), polynomial(z, kQ));
+    __m256d r = _mm256_add_pd(base, _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(u, ratio), u), extra));
+
+    // |y| > |x| なら π/2 - r、x < 0 なら π - r、y < 0 なら符号を反転します。
+    __m256d swapped = _mm256_cmp_pd(ay, ax, _CMP_GT_OQ);
+    r = _mm256_blendv_pd(
+        r, _mm256_add_pd(_mm256_sub_pd(_mm256_set1_pd(kPiOver2), r), _mm256_set1_pd(kMoreBits)), swapped);
+    __m256d negative_x = _mm256_cmp_pd(x, zero, _CMP_LT_OQ);
+    r = _mm256_blendv_pd(
+        r, _mm256_add_pd(_mm256_sub_pd(_mm256_set1_pd(kPi), r), _mm256_set1_pd(2.0 * kMoreBits)), negative_x);
+    return _mm256_xor_pd(r, _mm256_and_pd(sign_bit, y));
+}
+
+/**
+ * @brief sinとcosを4レーン同時に求めます。|angle|はπ以下を想定しています。
+ *
+ * @details 角度をπ/4の偶数倍(=π/2の倍数)と残り(|残り| <= π/4)に分け、残りのsin/cosを多項式で近似します。
+ *          π/4の倍数を引くときは、π/4を3つのdoubleに分けて順に引き、桁落ちを防ぎます。
+ *          π/2の倍数が何個分か(象限)で、sinとcosの入れ替えと符号を決めます。
+ */
+__attribute__((target("avx2"))) void sinCosAvx2(__m256d angle, __m256d &sin_out, __m256d &cos_out) {
+    static const double kSin[] = {1.58962301576546568060e-10, -2.50507477628578072866e-8, 2.75573136213857245213e-6,
+                                  -1.98412698295895385996e-4, 8.33333333332211858878e-3, -1.66666666666666307295e-1};
+    static const double kCos[] = {-1.13585365213876817300e-11, 2.08757008419747316778e-9, -2.75573141792967388112e-7,
+                                  2.48015872888517045348e-5, -1.38888888888730564116e-3, 4.16666666666665929218e-2};
+    const __m256d sign_bit = _mm256_set1_pd(-0.0);
+    const __m256d half = _mm256_set1_pd(0.5);
+
+    __m256d negative = _mm256_and_pd(sign_bit, angle);
+    __m256d ax = _mm256_andnot_pd(sign_bit, angle);
+    // π/4の何倍かを求め、奇数なら1つ上の偶数にそろえます。
+    __m256d q = _mm256_floor_pd(_mm256_mul_pd(ax, _mm256_set1_pd(4.0 / kPi)));
+    __m256d odd = _mm256_sub_pd(q, _mm256_mul_pd(_mm256_set1_pd(2.0), _mm256_floor_pd(_mm256_mul_pd(q, half))));
+    q = _mm256_add_pd(q, odd);
+    __m256d rest = _mm256_sub_pd(ax, _mm256_mul_pd(q, _mm256_set1_pd(7.85398125648498535156e-1)));
+    rest = _mm256_sub_pd(rest, _mm256_mul_pd(q, _mm256_set1_pd(3.77489470793079817668e-8)));
+    rest = _mm256_sub_pd(rest, _mm256_mul_pd(q, _mm256_set1_pd(2.69515142907905952645e-15)));
+
+    __m256d zz = _mm256_mul_pd(rest, rest);
+    __m256d s = _mm256_add_pd(rest, _mm256_mul_pd(_mm256_mul_pd(rest, zz), polynomial(zz, kSin)));
+    __m256d c = _mm256_add_pd(_mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(half, zz)),
+                              _mm256_mul_pd(_mm256_mul_pd(zz, zz), polynomial(zz, kCos)));
+
+    // 象限(0〜3): 1と3ではsinとcosが入れ替わり、2と3ではsinの符号が、1と2ではcosの符号が反転します。
+    __m256d k = _mm256_mul_pd(q, half);
+    __m256d quadrant =
+        _mm256_sub_pd(k, _mm256_mul_pd(_mm256_set1_pd(4.0), _mm256_floor_pd(_mm256_mul_pd(k, _mm256_set1_pd(0.25)))));
+    __m256d quadrant_half = _mm256_mul_pd(quadrant, half);
+    __m256d bit0 = _mm256_cmp_pd(quadrant_half, _mm256_floor_pd(quadrant_half), _CMP_NEQ_OQ);
+    __m256d bit1 = _mm256_cmp_pd(quadrant, _mm256_set1_pd(2.0), _CMP_GE_OQ);
+    __m256d sin_v = _mm256_blendv_pd(s, c, bit0);
+    __m256d cos_v = _mm256_blendv_pd(c, s, bit0);
+    sin_v = _mm256_xor_pd(sin_v, _mm256_and_pd(sign_bit, bit1));
+    cos_v = _mm256_xor_pd(cos_v, _mm256_and_pd(sign_bit, _mm256_xor_pd(bit0, bit1)));
+    // sinは奇関数なので、元の角度が負なら符号を反転します。cosは偶関数なのでそのままです。
+    sin_out = _mm256_xor_pd(sin_v, negative);
+    cos_out = cos_v;
+}
+
+/**
+ * @brief Bowringの式で4点ずつ緯度経度高度を求めます。
+ *
+ * @details 演算の順序はスカラー版(ecefToGeodeticBowring)と同じで、違いはatan2を多項式で近似することだけです。
+ *          地球の中心(r = 0)を含む4点はスカラー版で計算します。
+ */
+__attribute__((target("avx2"))) void ecefToGeodeticBowringAvx2(const double *xs,
+                                                              const double *ys,
+                                                              const double *zs,
+                                                              size_t count,
+                                                              double *lats_deg,
+                                                              double *lons_deg,
+                                                              double *alts_m) {
+    constexpr double a = kWgs84A;
+    constexpr double b = kWgs84A * (1.0 - kWgs84F);
+    constexpr double e2 = kWgs84E2;
+    constexpr double ep2 = e2 / (1.0 - e2);
+    const __m256d to_deg = _mm256_set1_pd(180.0);
+    const __m256d pi = _mm256_set1_pd(M_PI);
+    const __m256d zero = _mm256_setzero_pd();
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d x = _mm256_loadu_pd(xs + i);
+        __m256d y = _mm256_loadu_pd(ys + i);
+        __m256d z = _mm256_loadu_pd(zs + i);
+        __m256d p = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(x, x), _mm256_mul_pd(y, y)));
+        __m256d za = _mm256_mul_pd(z, _mm256_set1_pd(a));
+        __m256d pb = _mm256_mul_pd(p, _mm256_set1_pd(b));
+        __m256d r = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(za, za), _mm256_mul_pd(pb, pb)));
+        if (_mm256_movemask_pd(_mm256_cmp_pd(r, zero, _CMP_EQ_OQ)) != 0) {
+            ecefToGeodeticScalar(GeodeticMethod::BOWRING, xs, ys, zs, i, i + 4, lats_deg, lons_deg, alts_m);
+            continue;
+        }
+        __m256d sin_theta = _mm256_div_pd(za, r);
+        __m256d cos_theta = _mm256_div_pd(pb, r);
+
+        __m256d num = _mm256_add_pd(
+            z, _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(ep2 * b), sin_theta), sin_theta), sin_theta));
+        __m256d den = _mm256_sub_pd(
+            p, _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(e2 * a), cos_theta), cos_theta), cos_theta));
+        __m256d hyp = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(num, num), _mm256_mul_pd(den, den)));
+        __m256d sin_lat = _mm256_div_pd(num, hyp);
+        __m256d cos_lat = _mm256_div_pd(den, hyp);
+        __m256d lat = atan2Avx2(num, den);
+
+        __m256d root = _mm256_sqrt_pd(_mm256_sub_pd(
+            _mm256_set1_pd(1.0), _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(e2), sin_lat), sin_lat)));
+        __m256d alt = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(p, cos_lat), _mm256_mul_pd(z, sin_lat)),
+                                    _mm256_mul_pd(_mm256_set1_pd(a), root));
+
+        _mm256_storeu_pd(lats_deg + i, _mm256_div_pd(_mm256_mul_pd(lat, to_deg), pi));
+        _mm256_storeu_pd(lons_deg + i, _mm256_div_pd(_mm256_mul_pd(atan2Avx2(y, x), to_deg), pi));
+        _mm256_storeu_pd(alts_m + i, alt);
+    }
+    ecefToGeodeticScalar(GeodeticMethod::BOWRING, xs, ys, zs, i, count, lats_deg, lons_deg, alts_m);
+}
+
+/**
+ * @brief 4点ずつ緯度経度高度をECEFへ変換します。演算の順序はgeodeticToEcefと同じで、sin/cosだけ多項式で近似します。
+ */
+__attribute__((target("avx2"))) void geodeticToEcefAvx2(const double *lats_deg,
+                                                       const double *lons_deg,
+                                                       const double *alts_m,
+                                                       size_t count,
+                                                       double *xs,
+                                                       double *ys,
+                                                       double *zs) {
+    constexpr double a = kWgs84A;
+    constexpr double e2 = kWgs84E2;
+    const __m256d pi = _mm256_set1_pd(M_PI);
+    const __m256d deg = _mm256_set1_pd(180.0);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d lat = _mm256_div_pd(_mm256_mul_pd(_mm256_loadu_pd(lats_deg + i), pi), deg);
+        __m256d lon = _mm256_div_pd(_mm256_mul_pd(_mm256_loadu_pd(lons_deg + i), pi), deg);
+        __m256d alt = _mm256_loadu_pd(alts_m + i);
+        __m256d sin_lat;
+        __m256d cos_lat;
+        __m256d sin_lon;
+        __m256d cos_lon;
+        sinCosAvx2(lat, sin_lat, cos_lat);
+        sinCosAvx2(lon, sin_lon, cos_lon);
+
+        __m256d n = _mm256_div_pd(
+            _mm256_set1_pd(a),
+            _mm256_sqrt_pd(_mm256_sub_pd(_mm256_set1_pd(1.0),
+                                         _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(e2), sin_lat), sin_lat))));
+        __m256d n_alt = _mm256_add_pd(n, alt);
+        _mm256_storeu_pd(xs + i, _mm256_mul_pd(_mm256_mul_pd(n_alt, cos_lat), cos_lon));
+        _mm256_storeu_pd(ys + i, _mm256_mul_pd(_mm256_mul_pd(n_alt, cos_lat), sin_lon));
+        _mm256_storeu_pd(zs + i,
+                         _mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(n, _mm256_set1_pd(1.0 - e2)), alt), sin_lat));
+    }
+    geodeticToEcefScalar(lats_deg, lons_deg, alts_m, i, count, xs, ys, zs);
+}
+#endif
+
+/**
+ * @brief 多項式で近似するSIMD版を使えるかどうかを返します。呼び出し側が近似を許し、CPUがAVX2以上のときだけです。
+ */
+bool useSimd(PositionKernelIsa isa, bool approximate) {
+#if defined(SOA_GEODETIC_BATCH_X86)
+    return approximate && isa != PositionKernelIsa::SCALAR;
+#else
+    (void)isa;
+    (void)approximate;
+    return false;
+#endif
+}
+
+} // namespace
+
+void ecefToGeodeticBatch(PositionKernelIsa isa,
+                         GeodeticMethod method,
+                         const double *xs,
+                         const double *ys,
+                         const double *zs,
+                         size_t count,
+                         double *lats_deg,
+                         double *lons_deg,
+                         double *alts_m) {
+    // 多項式で近似するのは、速さを優先するBOWRINGを選んだときだけです。
+    if (useSimd(isa, method == GeodeticMethod::BOWRING)) {
+#if defined(SOA_GEODETIC_BATCH_X86)
+        ecefToGeodeticBowringAvx2(xs, ys, zs, count, lats_deg, lons_deg, alts_m);
+        return;
+#endif
+    }
+    ecefToGeodeticScalar(method, xs, ys, zs, 0, count, lats_deg, lons_deg, alts_m);
+}
+
+void geodeticToEcefBatch(PositionKernelIsa isa,
+                         TrigKernel trig,
+                         const double *lats_deg,
+                         const double *lons_deg,
+                         const double *alts_m,
+                         size_t count,
+                         double *xs,
+                         double *ys,
+                         double *zs) {
+    if (useSimd(isa, trig == TrigKernel::POLYNOMIAL)) {
+#if defined(SOA_GEODETIC_BATCH_X86)
+        geodeticToEcefAvx2(lats_deg, lons_deg, alts_m, count, xs, ys, zs);
+        return;
+#endif
+    }
+    geodeticToEcefScalar(lats_deg, lons_deg, alts_m, 0, count, xs, ys, zs);
+}
@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CLI/CLI11.hpp"
+#include "geo.hpp"
+#include "geodetic_batch.hpp"
+
+/**
+ * @brief CLI引数の受け取り先をまとめる構造体です。
+ */
+struct Args {
+    int points = 1000000;
+    int repeats = 5;
+};
+
+/**
+ * @brief 1つの変換方法の計測結果です。誤差は反復法(ITERATIVE)との差です。
+ */
+struct BenchResult {
+    GeodeticMethod method = GeodeticMethod::ITERATIVE;
+    bool batch = false;
+    double ns_per_call = 0.0;
+    double max_lat_deg = 0.0;
+    double max_lon_deg = 0.0;
+    double max_alt_m = 0.0;
+};
+
+namespace {
+
+/**
+ * @brief シナリオの範囲(九州北部の約200km四方、高度-1km〜15km)にECEFの点を散らばらせます。乱数の種は固定です。
+ */
+std::vector<Ecef> makePoints(int count) {
+    std::mt19937 rng(20240612u);
+    std::uniform_real_distribution<double> lat(33.0, 34.8);
+    std::uniform_real_distribution<double> lon(129.0, 131.2);
+    std::uniform_real_distribution<double> alt(-1000.0, 15000.0);
+    std::vector<Ecef> points;
+    points.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        points.push_back(geodeticToEcef(lat(rng), lon(rng), alt(rng)));
+    }
+    return points;
+}
+
+/**
+ * @brief 全点を変換し、緯度経度高度を配列へ書き出します。最速の回の1回あたりの時間(ナノ秒)を返します。
+ */
+double measure(GeodeticMethod method, const std::vector<Ecef> &points, int repeats,
+               std::vector<double> &lats, std::vector<double> &lons, std::vector<double> &alts) {
+    using Clock = std::chrono::steady_clock;
+    double best_ns = 0.0;
+    for (int r = 0; r < repeats; ++r) {
+        auto t0 = Clock::now();
+        for (size_t i = 0; i < points.size(); ++i) {
+            ecefToGeodetic(method, points[i], lats[i], lons[i], alts[i]);
+        }
+        auto t1 = Clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(points.size());
+        best_ns = (r == 0) ? ns : std::min(best_ns, ns);
+    }
+    return best_ns;
+}
+
+/**
+ * @brief ecefToGeodeticBatchでSoA配列をまとめて変換し、最速の回の1点あたりの時間(ナノ秒)を返します。
+ */
+double measureBatch(GeodeticMethod method, const std::vector<double> &xs, const std::vector<double> &ys,
+                    const std::vector<double> &zs, int repeats, std::vector<double> &lats, std::vector<double> &lons,
+                    std::vector<double> &alts) {
+    using Clock = std::chrono::steady_clock;
+    PositionKernelIsa isa = selectPositionKernelIsa();
+    double best_ns = 0.0;
+    for (int r = 0; r < repeats; ++r) {
+        auto t0 = Clock::now();
+        ecefToGeodeticBatch(isa, method, xs.data(), ys.data(), zs.data(), xs.size(), lats.data(), lons.data(),
+                            alts.data());
+        auto t1 = Clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(xs.size());
+        best_ns = (r == 0) ? ns : std::min(best_ns, ns);
+    }
+    return best_ns;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    // ECEFから緯度経度高度への変換方法(反復法・Bowring・Vermeille)ごとに、
+    // 1回あたりの時間と、反復法との差の最大値を報告する計測用のツールです。
+    CLI::App app{"SoA C++ geodetic conversion benchmark"};
+    try {
+        Args args;
+        app.add_option("--points", args.points, "変換する点の数");
+        app.add_option("--repeats", args.repeats, "計測を繰り返す回数(最速の回を採ります)");
+        app.parse(argc, argv);
+
+        std::vector<Ecef> points = makePoints(args.points);
+        size_t count = points.size();
+        std::vector<double> ref_lats(count), ref_lons(count), ref_alts(count);
+        std::vector<double> lats(count), lons(count), alts(count);
+        std::vector<double> xs(count), ys(count), zs(count);
+        for (size_t i = 0; i < count; ++i) {
+            xs[i] = points[i].x;
+            ys[i] = points[i].y;
+            zs[i] = points[i].z;
+        }
+
+        std::vector<BenchResult> results;
+        for (GeodeticMethod method : {GeodeticMethod::ITERATIVE, GeodeticMethod::BOWRING, GeodeticMethod::VERMEILLE}) {
+            BenchResult result;
+            result.method = method;
+            if (method == GeodeticMethod::ITERATIVE) {
+                result.ns_per_call = measure(method, points, args.repeats, ref_lats, ref_lons, ref_alts);
+            } else {
+                result.ns_per_call = measure(method, points, args.repeats, lats, lons, alts);
+                for (size_t i = 0; i < count; ++i) {
+                    result.max_lat_deg = std::max(result.max_lat_deg, std::abs(lats[i] - ref_lats[i]));
+                    result.max_lon_deg = std::max(result.max_lon_deg, std::abs(lons[i] - ref_lons[i]));
+                    result.max_alt_m = std::max(result.max_alt_m, std::abs(alts[i] - ref_alts[i]));
+                }
+            }
+            results.push_back(result);
+        }
+        // まとめての変換(SoA配列)です。BOWRINGはAVX2以上のCPUでSIMD版になります。
+        for (GeodeticMethod method : {GeodeticMethod::ITERATIVE, GeodeticMethod::BOWRING, GeodeticMethod::VERMEILLE}) {
+            BenchResult result;
+            result.method = method;
+            result.batch = true;
+            result.ns_per_call = measureBatch(method, xs, ys, zs, args.repeats, lats, lons, alts);
+            for (size_t i = 0; i < count; ++i) {
+                result.max_lat_deg = std::max(result.max_lat_deg, std::abs(lats[i] - ref_lats[i]));
+                result.max_lon_deg = std::max(result.max_lon_deg, std::abs(lons[i] - ref_lons[i]));
+                result.max_alt_m = std::max(result.max_alt_m, std::abs(alts[i] - ref_alts[i]));
+            }
+            results.push_back(result);
+        }
+
+        std::cout << "points " << args.points << ", repeats " << args.repeats << ", isa "
+                  << positionKernelIsaName(selectPositionKernelIsa()) << "\n";
+        std::cout << "method          ns/call   max_lat_deg  max_lon_deg  max_alt_m\n";
+        for (const auto &result : results) {
+            std::string name = std::string(geodeticMethodName(result.method)) + (result.batch ? "+batch" : "");
+            std::cout << std::left << std::setw(16) << name << std::setw(10) << std::fixed
+                      << std::setprecision(1) << result.ns_per_call << std::scientific << std::setprecision(2)
+                      << std::setw(13) << result.max_lat_deg << std::setw(13) << result.max_lon_deg
+                      << result.max_alt_m << "\n";
+        }
+    } catch (const CLI::ParseError &error) {
+        return app.exit(error);
+    }
+    return 0;
+}
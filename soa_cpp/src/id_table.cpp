@@ -0,0 +1,18 @@
+#include "id_table.hpp"
+
+uint32_t IdTable::intern(const std::string &name) {
+    // 初めて見る文字列なら末尾に追加し、その位置をハンドルとして覚えます。
+    auto it = m_handles.find(name);
+    if (it != m_handles.end()) {
+        return it->second;
+    }
+    uint32_t handle = static_cast<uint32_t>(m_names.size());
+    m_names.push_back(name);
+    m_handles.emplace(name, handle);
+    return handle;
+}
+
+void IdTable::clear() {
+    m_names.clear();
+    m_handles.clear();
+}
@@ -0,0 +1,66 @@
+#include "json_writer.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+
+#include "nlohmann/json.hpp"
+
+void JsonBuffer::appendString(const std::string &text) {
+    // nlohmann::jsonのdump_escaped(ensure_ascii=false)と同じ規則でエスケープします。
+    static constexpr char kHex[] = "0123456789abcdef";
+    m_bytes.push_back('"');
+    for (char c : text) {
+        unsigned char byte = static_cast<unsigned char>(c);
+        switch (c) {
+        case '"':
+            m_bytes.append("\\\"", 2);
+            break;
+        case '\\':
+            m_bytes.append("\\\\", 2);
+            break;
+        case '\b':
+            m_bytes.append("\\b", 2);
+            break;
+        case '\f':
+            m_bytes.append("\\f", 2);
+            break;
+        case '\n':
+            m_bytes.append("\\n", 2);
+            break;
+        case '\r':
+            m_bytes.append("\\r", 2);
+            break;
+        case '\t':
+            m_bytes.append("\\t", 2);
+            break;
+        default:
+            if (byte <= 0x1F) {
+                char escaped[6] = {'\\', 'u', '0', '0', kHex[byte >> 4], kHex[byte & 0x0F]};
+                m_bytes.append(escaped, sizeof(escaped));
+            } else {
+                m_bytes.push_back(c);
+            }
+            break;
+        }
+    }
+    m_bytes.push_back('"');
+}
+
+void JsonBuffer::appendInt(int64_t value) {
+    std::array<char, 24> digits{};
+    auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    m_bytes.append(digits.data(), static_cast<size_t>(result.ptr - digits.data()));
+}
+
+void JsonBuffer::appendDouble(double value) {
+    if (!std::isfinite(value)) {
+        m_bytes.append("null", 4);
+        return;
+    }
+    // dump()が内部で使う変換(Grisu2と書式の整え)をそのまま呼び、出力をバイト単位でそろえます。
+    // 作業領域の大きさもdump()と同じ64バイトです。
+    std::array<char, 64> digits{};
+    char *end = nlohmann::detail::to_chars(digits.data(), digits.data() + digits.size(), value);
+    m_bytes.append(digits.data(), static_cast<size_t>(end - digits.data()));
+}
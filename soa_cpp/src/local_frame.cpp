@@ -0,0 +1,106 @@
+#include "local_frame.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+double dot(const Ecef &a, const Ecef &b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+} // namespace
+
+CoordinateMode selectCoordinateMode() {
+    const char *requested = std::getenv("SOA_COORDINATE_MODE");
+    if (requested == nullptr) {
+        return CoordinateMode::ECEF_F64;
+    }
+    std::string name(requested);
+    if (name == coordinateModeName(CoordinateMode::ENU_F32)) {
+        return CoordinateMode::ENU_F32;
+    }
+    return CoordinateMode::ECEF_F64;
+}
+
+const char *coordinateModeName(CoordinateMode mode) {
+    switch (mode) {
+    case CoordinateMode::ECEF_F64:
+        return "ecef";
+    case CoordinateMode::ENU_F32:
+        return "enu32";
+    }
+    return "unknown";
+}
+
+LocalFrame makeLocalFrame(double lat_deg, double lon_deg) {
+    // 原点の緯度経度から、東・北・上の3方向の単位ベクトルをECEFの成分で求めます。
+    double lat = lat_deg * M_PI / 180.0;
+    double lon = lon_deg * M_PI / 180.0;
+    double sin_lat = std::sin(lat);
+    double cos_lat = std::cos(lat);
+    double sin_lon = std::sin(lon);
+    double cos_lon = std::cos(lon);
+
+    LocalFrame frame;
+    frame.origin = geodeticToEcef(lat_deg, lon_deg, 0.0);
+    frame.east = Ecef{-sin_lon, cos_lon, 0.0};
+    frame.north = Ecef{-sin_lat * cos_lon, -sin_lat * sin_lon, cos_lat};
+    frame.up = Ecef{cos_lat * cos_lon, cos_lat * sin_lon, sin_lat};
+    return frame;
+}
+
+LocalFrame makeCentroidFrame(const std::vector<RoutePoint> &route_points) {
+    if (route_points.empty()) {
+        return LocalFrame{};
+    }
+    // ECEFで平均を取ってから緯度経度へ戻すと、経度の折り返しなどを気にせず中心が求まります。
+    Ecef sum{0.0, 0.0, 0.0};
+    for (const auto &point : route_points) {
+        sum.x += point.ecef.x;
+        sum.y += point.ecef.y;
+        sum.z += point.ecef.z;
+    }
+    double count = static_cast<double>(route_points.size());
+    Ecef centroid{sum.x / count, sum.y / count, sum.z / count};
+    double lat = 0.0;
+    double lon = 0.0;
+    double alt = 0.0;
+    ecefToGeodetic(centroid, lat, lon, alt);
+    return makeLocalFrame(lat, lon);
+}
+
+EnuF32 ecefToEnu(const LocalFrame &frame, const Ecef &pos) {
+    // 原点からの差分をdoubleで求めてから回転し、最後にfloatへ丸めます。
+    Ecef d{pos.x - frame.origin.x, pos.y - frame.origin.y, pos.z - frame.origin.z};
+    return rotateToEnu(frame, d);
+}
+
+EnuF32 rotateToEnu(const LocalFrame &frame, const Ecef &vec) {
+    return EnuF32{
+        static_cast<float>(dot(frame.east, vec)),
+        static_cast<float>(dot(frame.north, vec)),
+        static_cast<float>(dot(frame.up, vec)),
+    };
+}
+
+Ecef enuToEcef(const LocalFrame &frame, const EnuF32 &pos) {
+    // 回転行列は直交行列なので、逆変換は転置(各方向ベクトルの重ね合わせ)で求まります。
+    double e = static_cast<double>(pos.e);
+    double n = static_cast<double>(pos.n);
+    double u = static_cast<double>(pos.u);
+    return Ecef{
+        frame.origin.x + frame.east.x * e + frame.north.x * n + frame.up.x * u,
+        frame.origin.y + frame.east.y * e + frame.north.y * n + frame.up.y * u,
+        frame.origin.z + frame.east.z * e + frame.north.z * n + frame.up.z * u,
+    };
+}
+
+SegmentMotionF32 toEnuMotion(const LocalFrame &frame, const SegmentMotion &motion) {
+    return SegmentMotionF32{
+        ecefToEnu(frame, motion.start),
+        rotateToEnu(frame, motion.velocity_mps),
+        motion.start_sec,
+    };
+}
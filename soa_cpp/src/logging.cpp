@@ -1,5 +1,6 @@
 #include "logging.hpp"
 
+#include <cstdio>
 #include <stdexcept>
 #include <vector>
 
@@ -7,54 +8,86 @@
 #include "spdlog/sinks/basic_file_sink.h"
 
 #include "geo.hpp"
-#include "jsonobj/timeline.hpp"
+#include "geodetic_batch.hpp"
 #include "soa_storage.hpp"
 #include "soa_simulation.hpp"
 
 void TimelineLogger::open(const std::string &path) {
     // タイムラインログの出力先を開き、失敗したら例外で知らせます。
-    m_logger.reset();
-    auto sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(path, true);
-    m_logger = std::make_shared<spdlog::logger>("soa_timeline_logger", sink);
-    m_logger->set_level(spdlog::level::info);
-    m_logger->set_pattern("%v");
-    m_logger->flush_on(spdlog::level::info);
+    m_file.reset(std::fopen(path.c_str(), "wb"));
+    if (!m_file) {
+        throw std::runtime_error("timeline: failed to open " + path);
+    }
+    // 1行ずつ組み立ててから書き込むため、標準ライブラリ側のバッファは要りません。
+    // バッファを外すと、fwriteの1回がそのままファイルへの1回の書き込みになります。
+    std::setvbuf(m_file.get(), nullptr, _IONBF, 0);
+}
+
+void TimelineLogger::prepare(const SoaStorage &storage, const SoaSimulation &simulation) {
+    // 毎秒変わらない部分を、書き出すときと同じ書式でシナリオの順番に組み立てます。
+    JsonBuffer tail;
+    m_row_tails.clear();
+    m_row_tail_offsets.clear();
+    m_row_tail_offsets.reserve(storage.scenario_order.size() + 1);
+    m_row_tail_offsets.push_back(0);
+    for (uint32_t i : storage.scenario_order) {
+        tail.clear();
+        tail.appendRaw(",\"object_id\":");
+        tail.appendString(storage.objectId(i));
+        tail.appendRaw(",\"role\":");
+        tail.appendString(simulation.roleToString(storage.roles[i]));
+        tail.appendRaw(",\"team_id\":");
+        tail.appendString(storage.teamId(i));
+        tail.appendRaw('}');
+        m_row_tails.append(tail.data(), tail.size());
+        m_row_tail_offsets.push_back(m_row_tails.size());
+    }
 }
 
 void TimelineLogger::write(int time_sec, const SoaStorage &storage, const SoaSimulation &simulation) {
     // 1秒分のタイムラインをJSONにまとめ、ndjsonとして1行で出力します。
-    if (!m_logger) {
+    if (!m_file) {
         throw std::runtime_error("timeline: logger is not initialized");
     }
+    if (m_row_tail_offsets.size() != storage.scenario_order.size() + 1) {
+        throw std::runtime_error("timeline: rows are not prepared");
+    }
 
-    jsonobj::Timeline timeline;
-    timeline.setTimeSec(time_sec);
-    std::vector<jsonobj::TimelinePosition> positions;
-    positions.reserve(storage.object_ids.size());
+    // 全オブジェクトの緯度経度高度を、SoAの位置配列からまとめて求めます。
+    // 1点ずつ変換する代わりに配列単位で渡すことで、SIMD命令で複数の点を同時に変換できます。
+    size_t count = storage.object_handles.size();
+    m_lats.resize(count);
+    m_lons.resize(count);
+    m_alts.resize(count);
+    ecefToGeodeticBatch(simulation.positionKernelIsa(), activeGeodeticMethod(), storage.ecef_xs.data(),
+                        storage.ecef_ys.data(), storage.ecef_zs.data(), count, m_lats.data(), m_lons.data(),
+                        m_alts.data());
 
-    for (size_t i = 0; i < storage.object_ids.size(); ++i) {
-        jsonobj::TimelinePosition position;
-        double lat = 0.0;
-        double lon = 0.0;
-        double alt = 0.0;
-        ecefToGeodetic(
-            Ecef{storage.ecef_xs[i], storage.ecef_ys[i], storage.ecef_zs[i]},
-            lat,
-            lon,
-            alt);
-        position.setObjectId(storage.object_ids[i]);
-        position.setTeamId(storage.team_ids[i]);
-        position.setRole(simulation.roleToString(storage.roles[i]));
-        position.setLatDeg(lat);
-        position.setLonDeg(lon);
-        position.setAltM(alt);
-        positions.push_back(position);
+    // キーはnlohmann::json(std::map)のdump()と同じ辞書順に並べます(timeline.schema.jsonの項目と同じです)。
+    // 配列は空間の順に並べ替えていることがあるため、シナリオの順番(scenario_order)で書き出します。
+    m_buffer.clear();
+    m_buffer.appendRaw("{\"positions\":[");
+    for (size_t k = 0; k < storage.scenario_order.size(); ++k) {
+        uint32_t i = storage.scenario_order[k];
+        if (k != 0) {
+            m_buffer.appendRaw(',');
+        }
+        m_buffer.appendRaw("{\"alt_m\":");
+        m_buffer.appendDouble(m_alts[i]);
+        m_buffer.appendRaw(",\"lat_deg\":");
+        m_buffer.appendDouble(m_lats[i]);
+        m_buffer.appendRaw(",\"lon_deg\":");
+        m_buffer.appendDouble(m_lons[i]);
+        // object_id・role・team_idは、prepareで組み立てておいた部分をそのまま写します。
+        m_buffer.appendRaw(m_row_tails.data() + m_row_tail_offsets[k], m_row_tail_offsets[k + 1] - m_row_tail_offsets[k]);
     }
+    m_buffer.appendRaw("],\"time_sec\":");
+    m_buffer.appendInt(time_sec);
+    m_buffer.appendRaw("}\n");
 
-    timeline.setPositions(positions);
-    nlohmann::json json_timeline;
-    jsonobj::to_json(json_timeline, timeline);
-    m_logger->info("{}", json_timeline.dump());
+    if (std::fwrite(m_buffer.data(), 1, m_buffer.size(), m_file.get()) != m_buffer.size()) {
+        throw std::runtime_error("timeline: failed to write");
+    }
 }
 
 void EventLogger::open(const std::string &path) {
@@ -0,0 +1,111 @@
+#include "morton_order.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <utility>
+
+namespace {
+
+/**
+ * @brief 32bitの値の各ビットの間に0を1つずつ挟み、64bitへ広げます。
+ */
+uint64_t spreadBits(uint32_t value) {
+    uint64_t bits = value;
+    bits = (bits | (bits << 16)) & 0x0000FFFF0000FFFFull;
+    bits = (bits | (bits << 8)) & 0x00FF00FF00FF00FFull;
+    bits = (bits | (bits << 4)) & 0x0F0F0F0F0F0F0F0Full;
+    bits = (bits | (bits << 2)) & 0x3333333333333333ull;
+    bits = (bits | (bits << 1)) & 0x5555555555555555ull;
+    return bits;
+}
+
+/**
+ * @brief values[新しい添字] = values[order[新しい添字]] となるように配列を並べ替えます。
+ *
+ * @details 長さがオブジェクト数と違う配列(その座標系では使わない空の配列など)はそのままにします。
+ */
+template <typename T>
+void permute(std::vector<T> &values, const std::vector<uint32_t> &order) {
+    if (values.size() != order.size()) {
+        return;
+    }
+    std::vector<T> sorted;
+    sorted.reserve(values.size());
+    for (uint32_t old_index : order) {
+        sorted.push_back(std::move(values[old_index]));
+    }
+    values.swap(sorted);
+}
+
+} // namespace
+
+int selectReorderInterval() {
+    const char *requested = std::getenv("SOA_REORDER_INTERVAL");
+    if (requested == nullptr) {
+        return 0;
+    }
+    char *end = nullptr;
+    long interval = std::strtol(requested, &end, 10);
+    if (end == requested || *end != '\0' || interval <= 0 || interval > INT_MAX) {
+        return 0;
+    }
+    return static_cast<int>(interval);
+}
+
+uint64_t mortonCode(const CellKey &key) {
+    // 符号ビットを反転すると、-1 < 0 < 1 の順番のまま符号なしの値になります。
+    uint32_t x = static_cast<uint32_t>(key.x) ^ 0x80000000u;
+    uint32_t y = static_cast<uint32_t>(key.y) ^ 0x80000000u;
+    return spreadBits(x) | (spreadBits(y) << 1);
+}
+
+void computeMortonOrder(const SoaStorage &storage, double cell_size, std::vector<uint32_t> &order) {
+    size_t count = storage.object_handles.size();
+    // (Mortonコード, 今の添字)の組で並べると、同じセルの中では今の並び順が保たれます。
+    std::vector<std::pair<uint64_t, uint32_t>> keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        keys.emplace_back(mortonCode(objectCellKey(storage, i, cell_size)), static_cast<uint32_t>(i));
+    }
+    std::sort(keys.begin(), keys.end());
+    order.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        order[i] = keys[i].second;
+    }
+}
+
+void applyStorageOrder(SoaStorage &storage, const std::vector<uint32_t> &order, std::vector<uint32_t> &new_indices) {
+    new_indices.resize(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        new_indices[order[i]] = static_cast<uint32_t>(i);
+    }
+
+    permute(storage.object_handles, order);
+    permute(storage.team_indices, order);
+    permute(storage.roles, order);
+    permute(storage.start_secs, order);
+    permute(storage.ecef_xs, order);
+    permute(storage.ecef_ys, order);
+    permute(storage.ecef_zs, order);
+    permute(storage.enu_es, order);
+    permute(storage.enu_ns, order);
+    permute(storage.enu_us, order);
+    permute(storage.prev_ecef_xs, order);
+    permute(storage.prev_ecef_ys, order);
+    permute(storage.prev_ecef_zs, order);
+    permute(storage.route_offsets, order);
+    permute(storage.route_counts, order);
+    permute(storage.segment_offsets, order);
+    permute(storage.segment_counts, order);
+    permute(storage.segment_cursors, order);
+    permute(storage.total_duration_secs, order);
+    permute(storage.detect_states, order);
+    permute(storage.has_detonated, order);
+    storage.detection_bits.permuteRows(order);
+
+    // シナリオでk番目のオブジェクトの添字を、新しい添字へ書き換えます。
+    for (uint32_t &index : storage.scenario_order) {
+        index = new_indices[index];
+    }
+}
@@ -0,0 +1,494 @@
+#include "position_kernel.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "local_frame.hpp"
+#include "route.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SOA_POSITION_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+/**
+ * @brief 1体分の位置をSoAの位置配列へ書き込みます。
+ */
+void storePosition(SoaStorage &storage, size_t index, const Ecef &pos) {
+    storage.ecef_xs[index] = pos.x;
+    storage.ecef_ys[index] = pos.y;
+    storage.ecef_zs[index] = pos.z;
+}
+
+/**
+ * @brief 1体分の局所座標をenu_*配列へ書き込みます。
+ */
+void storeEnu(SoaStorage &storage, size_t index, const EnuF32 &pos) {
+    storage.enu_es[index] = pos.e;
+    storage.enu_ns[index] = pos.n;
+    storage.enu_us[index] = pos.u;
+}
+
+/**
+ * @brief 1体分の位置を局所座標(float)で補間します。
+ *
+ * @details interpolatePositionScalarと同じ分岐で、経路点と移動レコードだけを局所座標版に置き換えたものです。
+ *          区間の開始時刻からの経過秒数はdoubleで求めてからfloatへ丸めるため、長い区間でも時刻の誤差は増えません。
+ */
+EnuF32 interpolateEnuF32(SoaStorage &storage, size_t i, int time_sec) {
+    size_t route_count = storage.route_counts[i];
+    if (route_count == 0) {
+        return ecefToEnu(storage.frame, Ecef{0.0, 0.0, 0.0});
+    }
+
+    size_t route_offset = storage.route_offsets[i];
+    const EnuF32 &first = storage.route_enus[route_offset];
+    const EnuF32 &last = storage.route_enus[route_offset + route_count - 1];
+
+    if (storage.roles[i] == jsonobj::Role::COMMANDER || time_sec < storage.start_secs[i]) {
+        return first;
+    }
+
+    size_t segment_count = storage.segment_counts[i];
+    double elapsed = static_cast<double>(time_sec - storage.start_secs[i]);
+    if (segment_count == 0 || elapsed >= storage.total_duration_secs[i]) {
+        return last;
+    }
+
+    size_t segment_offset = storage.segment_offsets[i];
+    storage.segment_cursors[i] = advanceSegmentCursor(
+        storage.segment_end_secs.data() + segment_offset,
+        segment_count,
+        storage.segment_cursors[i],
+        elapsed);
+    size_t segment_index = storage.segment_cursors[i];
+    if (segment_index >= segment_count) {
+        return last;
+    }
+
+    const SegmentMotionF32 &motion = storage.segment_motions_enu[segment_offset + segment_index];
+    float dt = static_cast<float>(elapsed - motion.start_sec);
+    return EnuF32{
+        motion.start.e + motion.velocity_mps.e * dt,
+        motion.start.n + motion.velocity_mps.n * dt,
+        motion.start.u + motion.velocity_mps.u * dt,
+    };
+}
+
+#if defined(SOA_POSITION_KERNEL_X86)
+// RoutePointとSegmentMotionは8バイトのdoubleだけで構成されているため、
+// 「何個目のdoubleか」という添字でgather(飛び飛びの読み込み)できます。
+static_assert(sizeof(RoutePoint) % sizeof(double) == 0, "RoutePoint must be an array of doubles");
+static_assert(sizeof(size_t) == sizeof(int64_t), "SIMD kernels expect 64-bit size_t");
+static_assert(sizeof(jsonobj::Role) == sizeof(int32_t), "SIMD kernels expect 32-bit roles");
+static_assert(sizeof(SegmentMotion) == sizeof(RoutePoint), "SIMD kernels share one stride for route points and motions");
+constexpr int64_t kRoutePointStride = static_cast<int64_t>(sizeof(RoutePoint) / sizeof(double));
+
+/**
+ * @brief size_tの配列から、添字で指定した4件をまとめて読み込みます。
+ */
+__attribute__((target("avx2"))) __m256i gatherSizes(const std::vector<size_t> &values, __m256i index) {
+    return _mm256_i64gather_epi64(reinterpret_cast<const long long *>(values.data()), index, 8);
+}
+
+/**
+ * @brief 先頭のECEF x座標へのポインタを返します。y/zはこの+1/+2の位置にあります。
+ */
+const double *routeEcefBase(const SoaStorage &storage) {
+    if (storage.route_points.empty()) {
+        return nullptr;
+    }
+    return &storage.route_points.front().ecef.x;
+}
+
+/**
+ * @brief 先頭の区間移動レコードの始点x座標へのポインタを返します。
+ *
+ * @details 始点y/z、速度x/y/z、開始時刻はこの+1から+6の位置にあります。
+ */
+const double *segmentMotionBase(const SoaStorage &storage) {
+    if (storage.segment_motions.empty()) {
+        return nullptr;
+    }
+    return &storage.segment_motions.front().start.x;
+}
+
+/**
+ * @brief AVX2(256bit幅、doubleを4個同時)で位置を補間します。
+ *
+ * @details 1レーン=1オブジェクトとして、分岐の代わりにマスク(レーンごとの真偽)で処理を選びます。
+ *          対象は添字の一覧で渡されるため、各属性は添字を使ってgather(飛び飛びの読み込み)します。
+ *          - 司令官・開始前のレーンは最初の経路点
+ *          - 区間が無い・移動完了のレーンは最後の経路点
+ *          - 前回の区間カーソルがそのまま使えるレーンは直線補間
+ *          それ以外(経路なし・区間またぎ・時刻の巻き戻し)はスカラー版で計算し直します。
+ *          速度0の区間や長さ0の区間は速度0の移動レコードなので、そのままSIMDで補間できます。
+ *          演算順序はスカラー版と同じなので、補間結果はビット単位で一致します。
+ */
+__attribute__((target("avx2"))) void computePositionsAvx2(SoaStorage &storage,
+                                                         int time_sec,
+                                                         const size_t *indices,
+                                                         size_t count) {
+    const double *route_x = routeEcefBase(storage);
+    const double *motion_x = segmentMotionBase(storage);
+    const double *segment_ends = storage.segment_end_secs.data();
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i all_ones = _mm256_set1_epi64x(-1);
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i stride = _mm256_set1_epi64x(kRoutePointStride);
+    const __m256d zero_pd = _mm256_setzero_pd();
+    const __m128i time_v = _mm_set1_epi32(time_sec);
+    const __m128i commander = _mm_set1_epi32(static_cast<int32_t>(jsonobj::Role::COMMANDER));
+
+    alignas(32) double xs[4];
+    alignas(32) double ys[4];
+    alignas(32) double zs[4];
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        // 4体分の属性を、添字を使って各配列からまとめて読み込みます。
+        __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+        __m256i route_count = gatherSizes(storage.route_counts, index);
+        __m256i route_offset = gatherSizes(storage.route_offsets, index);
+        __m256i segment_count = gatherSizes(storage.segment_counts, index);
+        __m256i segment_offset = gatherSizes(storage.segment_offsets, index);
+        __m256i cursor = gatherSizes(storage.segment_cursors, index);
+        __m128i start = _mm256_i64gather_epi32(storage.start_secs.data(), index, 4);
+        __m128i role = _mm256_i64gather_epi32(reinterpret_cast<const int *>(storage.roles.data()), index, 4);
+        __m256d total = _mm256_i64gather_pd(storage.total_duration_secs.data(), index, 8);
+
+        // 経過秒数はスカラー版と同じく「整数で引き算してからdoubleへ変換」します。
+        __m128i elapsed_i = _mm_sub_epi32(time_v, start);
+        __m256d elapsed = _mm256_cvtepi32_pd(elapsed_i);
+
+        // スカラー版のif文の順番どおりに、各レーンがどの分岐に入るかをマスクで求めます。
+        __m256i no_route = _mm256_cmpeq_epi64(route_count, zero);
+        __m256i is_commander = _mm256_cvtepi32_epi64(_mm_cmpeq_epi32(role, commander));
+        __m256i not_started = _mm256_cvtepi32_epi64(_mm_cmplt_epi32(elapsed_i, _mm_setzero_si128()));
+        __m256i at_first = _mm256_andnot_si256(no_route, _mm256_or_si256(is_commander, not_started));
+        __m256i no_segment = _mm256_cmpeq_epi64(segment_count, zero);
+        __m256i past_end = _mm256_castpd_si256(_mm256_cmp_pd(elapsed, total, _CMP_GE_OQ));
+        __m256i at_last = _mm256_andnot_si256(_mm256_or_si256(no_route, at_first),
+                                              _mm256_or_si256(no_segment, past_end));
+        __m256i fixed = _mm256_or_si256(at_first, at_last);
+        __m256i moving = _mm256_andnot_si256(_mm256_or_si256(no_route, fixed), all_ones);
+
+        // 移動中のレーンだけ、カーソル位置の区間終了時刻と区間の移動レコード(始点・速度・開始時刻)を集めます。
+        __m256i cursor_valid = _mm256_and_si256(moving, _mm256_cmpgt_epi64(segment_count, cursor));
+        __m256i end_index = _mm256_add_epi64(segment_offset, cursor);
+        __m256d segment_end = _mm256_mask_i64gather_pd(
+            zero_pd, segment_ends, end_index, _mm256_castsi256_pd(cursor_valid), 8);
+        // 移動レコードの添字(doubleの個数単位)です。添字は下位32bitで計算しますが、区間が数億個を超えない限り問題ありません。
+        __m256i motion_index = _mm256_mul_epu32(end_index, stride);
+        __m256d segment_start = _mm256_mask_i64gather_pd(
+            zero_pd, motion_x + 6, motion_index, _mm256_castsi256_pd(cursor_valid), 8);
+
+        // 前回のカーソルのまま「区間開始 <= 経過 < 区間終了」を満たすならそのまま補間できます。
+        // 満たさないレーン(区間またぎ・時刻の巻き戻しなど)は後でスカラー版に任せます。
+        __m256d in_segment = _mm256_and_pd(_mm256_cmp_pd(elapsed, segment_end, _CMP_LT_OQ),
+                                           _mm256_cmp_pd(segment_start, elapsed, _CMP_LE_OQ));
+        __m256i interpolate = _mm256_and_si256(cursor_valid, _mm256_castpd_si256(in_segment));
+        __m256i fallback = _mm256_or_si256(no_route, _mm256_andnot_si256(interpolate, moving));
+
+        // 固定位置のレーンは、先頭または末尾の経路点を読み出します。
+        __m256i first_index = _mm256_mul_epu32(route_offset, stride);
+        __m256i last_index = _mm256_mul_epu32(_mm256_sub_epi64(_mm256_add_epi64(route_offset, route_count), one), stride);
+        __m256i fixed_index = _mm256_blendv_epi8(last_index, first_index, at_first);
+        __m256d load_fixed = _mm256_castsi256_pd(fixed);
+        __m256d fx = _mm256_mask_i64gather_pd(zero_pd, route_x, fixed_index, load_fixed, 8);
+        __m256d fy = _mm256_mask_i64gather_pd(zero_pd, route_x + 1, fixed_index, load_fixed, 8);
+        __m256d fz = _mm256_mask_i64gather_pd(zero_pd, route_x + 2, fixed_index, load_fixed, 8);
+
+        // 補間するレーンは、区間の始点と速度ベクトルを読み出します。
+        __m256d load_motion = _mm256_castsi256_pd(interpolate);
+        __m256d px = _mm256_mask_i64gather_pd(zero_pd, motion_x, motion_index, load_motion, 8);
+        __m256d py = _mm256_mask_i64gather_pd(zero_pd, motion_x + 1, motion_index, load_motion, 8);
+        __m256d pz = _mm256_mask_i64gather_pd(zero_pd, motion_x + 2, motion_index, load_motion, 8);
+        __m256d vx = _mm256_mask_i64gather_pd(zero_pd, motion_x + 3, motion_index, load_motion, 8);
+        __m256d vy = _mm256_mask_i64gather_pd(zero_pd, motion_x + 4, motion_index, load_motion, 8);
+        __m256d vz = _mm256_mask_i64gather_pd(zero_pd, motion_x + 5, motion_index, load_motion, 8);
+
+        // スカラー版(segmentPosition)と同じ式 start + v * (elapsed - start_sec) で補間し、
+        // 固定位置のレーンは経路点をそのまま使います。
+        __m256d dt = _mm256_sub_pd(elapsed, segment_start);
+        __m256d x = _mm256_add_pd(px, _mm256_mul_pd(vx, dt));
+        __m256d y = _mm256_add_pd(py, _mm256_mul_pd(vy, dt));
+        __m256d z = _mm256_add_pd(pz, _mm256_mul_pd(vz, dt));
+        x = _mm256_blendv_pd(x, fx, load_fixed);
+        y = _mm256_blendv_pd(y, fy, load_fixed);
+        z = _mm256_blendv_pd(z, fz, load_fixed);
+
+        // AVX2には飛び飛びの書き込み(scatter)が無いため、レーンごとにSoAの位置配列へ書き戻します。
+        _mm256_store_pd(xs, x);
+        _mm256_store_pd(ys, y);
+        _mm256_store_pd(zs, z);
+        int fallback_bits = _mm256_movemask_pd(_mm256_castsi256_pd(fallback));
+        for (size_t lane = 0; lane < 4; ++lane) {
+            size_t object_index = indices[i + lane];
+            if (fallback_bits & (1 << lane)) {
+                storePosition(storage, object_index, interpolatePositionScalar(storage, object_index, time_sec));
+            } else {
+                storePosition(storage, object_index, Ecef{xs[lane], ys[lane], zs[lane]});
+            }
+        }
+    }
+
+    // 4体に満たない端数はスカラー版で処理します。
+    for (; i < count; ++i) {
+        storePosition(storage, indices[i], interpolatePositionScalar(storage, indices[i], time_sec));
+    }
+}
+
+/**
+ * @brief AVX-512(512bit幅、doubleを8個同時)で位置を補間します。
+ *
+ * @details 処理の流れはAVX2版と同じです。AVX-512ではレーンごとの真偽を専用のマスクレジスタ
+ *          (1bit=1レーン)で持てるため、マスク同士の論理演算を整数のビット演算で書けます。
+ *          また飛び飛びの書き込み(scatter)があるので、結果もSoAの位置配列へまとめて書き戻せます。
+ */
+__attribute__((target("avx512f"))) void computePositionsAvx512(SoaStorage &storage,
+                                                              int time_sec,
+                                                              const size_t *indices,
+                                                              size_t count) {
+    const double *route_x = routeEcefBase(storage);
+    const double *motion_x = segmentMotionBase(storage);
+    const double *segment_ends = storage.segment_end_secs.data();
+
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i stride = _mm512_set1_epi64(kRoutePointStride);
+    const __m512i commander = _mm512_set1_epi64(static_cast<int64_t>(jsonobj::Role::COMMANDER));
+    const __m512d zero_pd = _mm512_setzero_pd();
+    const __m256i zero_epi32 = _mm256_setzero_si256();
+    const __mmask8 all_lanes = 0xFF;
+    const __m256i time_v = _mm256_set1_epi32(time_sec);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512i index = _mm512_loadu_si512(indices + i);
+        // マスクなしのgatherや型変換・乗算は、結果の初期値を未定義のまま組み込み関数へ渡すため、GCCが未初期化の警告を出します。
+        // このカーネルでは、下のマスク付きのgatherと同じく0の初期値(またはmaskz形式)と全レーン有効のマスクを明示します。
+        __m512i route_count = _mm512_mask_i64gather_epi64(zero, all_lanes, index, storage.route_counts.data(), 8);
+        __m512i route_offset = _mm512_mask_i64gather_epi64(zero, all_lanes, index, storage.route_offsets.data(), 8);
+        __m512i segment_count = _mm512_mask_i64gather_epi64(zero, all_lanes, index, storage.segment_counts.data(), 8);
+        __m512i segment_offset =
+            _mm512_mask_i64gather_epi64(zero, all_lanes, index, storage.segment_offsets.data(), 8);
+        __m512i cursor = _mm512_mask_i64gather_epi64(zero, all_lanes, index, storage.segment_cursors.data(), 8);
+        __m256i start = _mm512_mask_i64gather_epi32(zero_epi32, all_lanes, index, storage.start_secs.data(), 4);
+        __m256i role = _mm512_mask_i64gather_epi32(zero_epi32, all_lanes, index, storage.roles.data(), 4);
+        __m512d total = _mm512_mask_i64gather_pd(zero_pd, all_lanes, index, storage.total_duration_secs.data(), 8);
+
+        __m256i elapsed_i = _mm256_sub_epi32(time_v, start);
+        __m512d elapsed = _mm512_maskz_cvtepi32_pd(all_lanes, elapsed_i);
+
+        __mmask8 no_route = _mm512_cmpeq_epi64_mask(route_count, zero);
+        __mmask8 is_commander = _mm512_cmpeq_epi64_mask(_mm512_maskz_cvtepi32_epi64(all_lanes, role), commander);
+        __mmask8 not_started = _mm512_cmplt_epi64_mask(_mm512_maskz_cvtepi32_epi64(all_lanes, elapsed_i), zero);
+        __mmask8 at_first = static_cast<__mmask8>((is_commander | not_started) & ~no_route);
+        __mmask8 no_segment = _mm512_cmpeq_epi64_mask(segment_count, zero);
+        __mmask8 past_end = _mm512_cmp_pd_mask(elapsed, total, _CMP_GE_OQ);
+        __mmask8 at_last = static_cast<__mmask8>((no_segment | past_end) & ~(no_route | at_first));
+        __mmask8 fixed = static_cast<__mmask8>(at_first | at_last);
+        __mmask8 moving = static_cast<__mmask8>(~(no_route | fixed));
+
+        __mmask8 cursor_valid = static_cast<__mmask8>(moving & _mm512_cmpgt_epi64_mask(segment_count, cursor));
+        __m512i end_index = _mm512_add_epi64(segment_offset, cursor);
+        __m512d segment_end = _mm512_mask_i64gather_pd(zero_pd, cursor_valid, end_index, segment_ends, 8);
+        __m512i motion_index = _mm512_maskz_mul_epu32(all_lanes, end_index, stride);
+        __m512d segment_start = _mm512_mask_i64gather_pd(zero_pd, cursor_valid, motion_index, motion_x + 6, 8);
+
+        __mmask8 in_segment = static_cast<__mmask8>(_mm512_cmp_pd_mask(elapsed, segment_end, _CMP_LT_OQ) &
+                                                    _mm512_cmp_pd_mask(segment_start, elapsed, _CMP_LE_OQ));
+        __mmask8 interpolate = static_cast<__mmask8>(cursor_valid & in_segment);
+        __mmask8 fallback = static_cast<__mmask8>(no_route | (moving & ~interpolate));
+
+        __m512i first_index = _mm512_maskz_mul_epu32(all_lanes, route_offset, stride);
+        __m512i last_index = _mm512_maskz_mul_epu32(
+            all_lanes, _mm512_sub_epi64(_mm512_add_epi64(route_offset, route_count), one), stride);
+        __m512i fixed_index = _mm512_mask_blend_epi64(at_first, last_index, first_index);
+        __m512d fx = _mm512_mask_i64gather_pd(zero_pd, fixed, fixed_index, route_x, 8);
+        __m512d fy = _mm512_mask_i64gather_pd(zero_pd, fixed, fixed_index, route_x + 1, 8);
+        __m512d fz = _mm512_mask_i64gather_pd(zero_pd, fixed, fixed_index, route_x + 2, 8);
+
+        __m512d px = _mm512_mask_i64gather_pd(zero_pd, interpolate, motion_index, motion_x, 8);
+        __m512d py = _mm512_mask_i64gather_pd(zero_pd, interpolate, motion_index, motion_x + 1, 8);
+        __m512d pz = _mm512_mask_i64gather_pd(zero_pd, interpolate, motion_index, motion_x + 2, 8);
+        __m512d vx = _mm512_mask_i64gather_pd(zero_pd, interpolate, motion_index, motion_x + 3, 8);
+        __m512d vy = _mm512_mask_i64gather_pd(zero_pd, interpolate, motion_index, motion_x + 4, 8);
+        __m512d vz = _mm512_mask_i64gather_pd(zero_pd, interpolate, motion_index, motion_x + 5, 8);
+
+        __m512d dt = _mm512_sub_pd(elapsed, segment_start);
+        __m512d x = _mm512_add_pd(px, _mm512_mul_pd(vx, dt));
+        __m512d y = _mm512_add_pd(py, _mm512_mul_pd(vy, dt));
+        __m512d z = _mm512_add_pd(pz, _mm512_mul_pd(vz, dt));
+        x = _mm512_mask_blend_pd(fixed, x, fx);
+        y = _mm512_mask_blend_pd(fixed, y, fy);
+        z = _mm512_mask_blend_pd(fixed, z, fz);
+
+        // SIMDで求めたレーンはscatterでまとめて書き戻し、残りのレーンだけスカラー版で計算します。
+        __mmask8 store = static_cast<__mmask8>(~fallback);
+        _mm512_mask_i64scatter_pd(storage.ecef_xs.data(), store, index, x, 8);
+        _mm512_mask_i64scatter_pd(storage.ecef_ys.data(), store, index, y, 8);
+        _mm512_mask_i64scatter_pd(storage.ecef_zs.data(), store, index, z, 8);
+        for (size_t lane = 0; lane < 8; ++lane) {
+            if (fallback & (1u << lane)) {
+                size_t object_index = indices[i + lane];
+                storePosition(storage, object_index, interpolatePositionScalar(storage, object_index, time_sec));
+            }
+        }
+    }
+
+    for (; i < count; ++i) {
+        storePosition(storage, indices[i], interpolatePositionScalar(storage, indices[i], time_sec));
+    }
+}
+#endif
+
+} // namespace
+
+bool isPositionKernelIsaSupported(PositionKernelIsa isa) {
+    switch (isa) {
+    case PositionKernelIsa::SCALAR:
+        return true;
+#if defined(SOA_POSITION_KERNEL_X86)
+    case PositionKernelIsa::AVX2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+    case PositionKernelIsa::AVX512:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f");
+#else
+    case PositionKernelIsa::AVX2:
+    case PositionKernelIsa::AVX512:
+        return false;
+#endif
+    }
+    return false;
+}
+
+PositionKernelIsa selectPositionKernelIsa() {
+    // まずCPUが対応している中で最も幅の広いカーネルを選びます。
+    PositionKernelIsa best = PositionKernelIsa::SCALAR;
+    if (isPositionKernelIsaSupported(PositionKernelIsa::AVX512)) {
+        best = PositionKernelIsa::AVX512;
+    } else if (isPositionKernelIsaSupported(PositionKernelIsa::AVX2)) {
+        best = PositionKernelIsa::AVX2;
+    }
+
+    // 計測や結果比較のため、環境変数で幅の狭いカーネルへ切り替えられるようにします。
+    // CPUが対応していない指定は無視し、自動選択の結果を使います。
+    const char *requested = std::getenv("SOA_POSITION_KERNEL");
+    if (requested == nullptr) {
+        return best;
+    }
+    std::string name(requested);
+    for (PositionKernelIsa isa : {PositionKernelIsa::SCALAR, PositionKernelIsa::AVX2, PositionKernelIsa::AVX512}) {
+        if (name == positionKernelIsaName(isa) && isPositionKernelIsaSupported(isa)) {
+            return isa;
+        }
+    }
+    return best;
+}
+
+const char *positionKernelIsaName(PositionKernelIsa isa) {
+    switch (isa) {
+    case PositionKernelIsa::SCALAR:
+        return "scalar";
+    case PositionKernelIsa::AVX2:
+        return "avx2";
+    case PositionKernelIsa::AVX512:
+        return "avx512";
+    }
+    return "unknown";
+}
+
+Ecef interpolatePositionScalar(SoaStorage &storage, size_t i, int time_sec) {
+    // 1体分の補間処理です。分岐(開始前・終了後・区間内など)はSIMD版のマスクと同じ順序で並べています。
+    size_t route_count = storage.route_counts[i];
+    if (route_count == 0) {
+        return Ecef{0.0, 0.0, 0.0};
+    }
+
+    size_t route_offset = storage.route_offsets[i];
+    const RoutePoint &first = storage.route_points[route_offset];
+
+    if (storage.roles[i] == jsonobj::Role::COMMANDER) {
+        return first.ecef;
+    }
+
+    if (time_sec < storage.start_secs[i]) {
+        return first.ecef;
+    }
+
+    size_t segment_count = storage.segment_counts[i];
+    if (segment_count == 0) {
+        return storage.route_points[route_offset + route_count - 1].ecef;
+    }
+
+    double elapsed = static_cast<double>(time_sec - storage.start_secs[i]);
+    double total_duration = storage.total_duration_secs[i];
+    if (elapsed >= total_duration) {
+        return storage.route_points[route_offset + route_count - 1].ecef;
+    }
+
+    size_t segment_offset = storage.segment_offsets[i];
+    // 前回の区間番号から前へ進めるだけで済むため、毎秒の二分探索を省けます。
+    storage.segment_cursors[i] = advanceSegmentCursor(
+        storage.segment_end_secs.data() + segment_offset,
+        segment_count,
+        storage.segment_cursors[i],
+        elapsed);
+    size_t segment_index = storage.segment_cursors[i];
+
+    if (segment_index >= segment_count) {
+        return storage.route_points[route_offset + route_count - 1].ecef;
+    }
+
+    // 区間の始点と速度ベクトルは前計算済みなので、掛け算と足し算だけで位置が求まります。
+    // 速度0の区間や長さ0の区間も、速度0のレコードとして同じ式で扱えます。
+    return segmentPosition(storage.segment_motions[segment_offset + segment_index], elapsed);
+}
+
+void computePositions(PositionKernelIsa isa,
+                      SoaStorage &storage,
+                      int time_sec,
+                      const size_t *indices,
+                      size_t count) {
+    // 選ばれたカーネルへ処理を振り分けます。どのカーネルでも結果は同じです。
+#if defined(SOA_POSITION_KERNEL_X86)
+    // SIMD版は経路点と移動レコードの配列の先頭からの位置(+1や+6)でgatherの基点を作ります。
+    // 配列が空のときはdata()がnullptrになり、そこへの加算は未定義動作なので、スカラー版に任せます。
+    bool simd_ready = count != 0 && !storage.route_points.empty() && !storage.segment_motions.empty();
+    if (!simd_ready) {
+        isa = PositionKernelIsa::SCALAR;
+    }
+    if (isa == PositionKernelIsa::AVX512) {
+        computePositionsAvx512(storage, time_sec, indices, count);
+        return;
+    }
+    if (isa == PositionKernelIsa::AVX2) {
+        computePositionsAvx2(storage, time_sec, indices, count);
+        return;
+    }
+#else
+    (void)isa;
+#endif
+    for (size_t i = 0; i < count; ++i) {
+        storePosition(storage, indices[i], interpolatePositionScalar(storage, indices[i], time_sec));
+    }
+}
+
+void computePositionsEnuF32(SoaStorage &storage,
+                            int time_sec,
+                            const size_t *indices,
+                            size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        storeEnu(storage, indices[i], interpolateEnuF32(storage, indices[i], time_sec));
+    }
+}
@@ -0,0 +1,133 @@
+#include "range_kernel.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SOA_RANGE_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+/**
+ * @brief beginからcountまでの相手をスカラーで判定し、範囲内のものを詰めて書き込みます。戻り値は書き込み後の件数です。
+ *
+ * @details 書き込みは毎回行い、範囲内のときだけ書き込み位置を1進めます。範囲外なら次の相手で上書きされます。
+ *          演算順序はdistanceEcefと同じです。
+ */
+size_t filterScalar(const Ecef &center, double range_sq, RangeCandidates &candidates, size_t begin, size_t passed_count) {
+    const double *xs = candidates.xs.data();
+    const double *ys = candidates.ys.data();
+    const double *zs = candidates.zs.data();
+    uint32_t *passed = candidates.passed.data();
+    double *dist_sqs = candidates.passed_dist_sqs.data();
+    size_t n = passed_count;
+    for (size_t i = begin; i < candidates.size(); ++i) {
+        double dx = center.x - xs[i];
+        double dy = center.y - ys[i];
+        double dz = center.z - zs[i];
+        double dist_sq = dx * dx + dy * dy + dz * dz;
+        passed[n] = static_cast<uint32_t>(i);
+        dist_sqs[n] = dist_sq;
+        n += (dist_sq <= range_sq) ? 1 : 0;
+    }
+    return n;
+}
+
+#if defined(SOA_RANGE_KERNEL_X86)
+/**
+ * @brief AVX2(doubleを4個同時)で距離の2乗を求めて判定します。
+ *
+ * @details 比較結果をmovemaskで4bitの整数にし、レーンごとにそのbitだけ書き込み位置を進めます。
+ *          4体に満たない端数はスカラー版で判定します。
+ */
+__attribute__((target("avx2"))) size_t filterAvx2(const Ecef &center, double range_sq, RangeCandidates &candidates) {
+    const double *xs = candidates.xs.data();
+    const double *ys = candidates.ys.data();
+    const double *zs = candidates.zs.data();
+    uint32_t *passed = candidates.passed.data();
+    double *dist_sqs = candidates.passed_dist_sqs.data();
+    const __m256d cx = _mm256_set1_pd(center.x);
+    const __m256d cy = _mm256_set1_pd(center.y);
+    const __m256d cz = _mm256_set1_pd(center.z);
+    const __m256d limit = _mm256_set1_pd(range_sq);
+    size_t count = candidates.size();
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d dx = _mm256_sub_pd(cx, _mm256_loadu_pd(xs + i));
+        __m256d dy = _mm256_sub_pd(cy, _mm256_loadu_pd(ys + i));
+        __m256d dz = _mm256_sub_pd(cz, _mm256_loadu_pd(zs + i));
+        __m256d dist_sq = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)),
+                                        _mm256_mul_pd(dz, dz));
+        int mask = _mm256_movemask_pd(_mm256_cmp_pd(dist_sq, limit, _CMP_LE_OQ));
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, dist_sq);
+        for (int lane = 0; lane < 4; ++lane) {
+            passed[n] = static_cast<uint32_t>(i + static_cast<size_t>(lane));
+            dist_sqs[n] = lanes[lane];
+            n += static_cast<size_t>((mask >> lane) & 1);
+        }
+    }
+    return filterScalar(center, range_sq, candidates, i, n);
+}
+
+/**
+ * @brief AVX-512(doubleを8個同時)で距離の2乗を求めて判定します。
+ *
+ * @details 比較結果のマスクレジスタをそのまま使い、範囲内のレーンだけをcompress store(詰めて書き込む命令)で書き出します。
+ *          8体に満たない端数はスカラー版で判定します。
+ */
+__attribute__((target("avx512f"))) size_t filterAvx512(const Ecef &center,
+                                                       double range_sq,
+                                                       RangeCandidates &candidates) {
+    const double *xs = candidates.xs.data();
+    const double *ys = candidates.ys.data();
+    const double *zs = candidates.zs.data();
+    uint32_t *passed = candidates.passed.data();
+    double *dist_sqs = candidates.passed_dist_sqs.data();
+    const __m512d cx = _mm512_set1_pd(center.x);
+    const __m512d cy = _mm512_set1_pd(center.y);
+    const __m512d cz = _mm512_set1_pd(center.z);
+    const __m512d limit = _mm512_set1_pd(range_sq);
+    const __m512i lane_offsets = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0);
+    size_t count = candidates.size();
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512d dx = _mm512_sub_pd(cx, _mm512_loadu_pd(xs + i));
+        __m512d dy = _mm512_sub_pd(cy, _mm512_loadu_pd(ys + i));
+        __m512d dz = _mm512_sub_pd(cz, _mm512_loadu_pd(zs + i));
+        __m512d dist_sq = _mm512_add_pd(_mm512_add_pd(_mm512_mul_pd(dx, dx), _mm512_mul_pd(dy, dy)),
+                                        _mm512_mul_pd(dz, dz));
+        __mmask8 mask = _mm512_cmp_pd_mask(dist_sq, limit, _CMP_LE_OQ);
+        __m512i order = _mm512_add_epi32(_mm512_set1_epi32(static_cast<int>(i)), lane_offsets);
+        _mm512_mask_compressstoreu_pd(dist_sqs + n, mask, dist_sq);
+        _mm512_mask_compressstoreu_epi32(passed + n, static_cast<__mmask16>(mask), order);
+        n += static_cast<size_t>(__builtin_popcount(static_cast<unsigned>(mask)));
+    }
+    return filterScalar(center, range_sq, candidates, i, n);
+}
+#endif
+
+} // namespace
+
+size_t filterWithinRange(PositionKernelIsa isa, const Ecef &center, double range_sq, RangeCandidates &candidates) {
+    // 詰めて書き込む先は、全員が範囲内でも足りる長さにしておきます。容量が足りていればヒープ確保は起きません。
+    candidates.passed.resize(candidates.size());
+    candidates.passed_dist_sqs.resize(candidates.size());
+    size_t n = 0;
+#if defined(SOA_RANGE_KERNEL_X86)
+    if (isa == PositionKernelIsa::AVX512) {
+        n = filterAvx512(center, range_sq, candidates);
+    } else if (isa == PositionKernelIsa::AVX2) {
+        n = filterAvx2(center, range_sq, candidates);
+    } else {
+        n = filterScalar(center, range_sq, candidates, 0, 0);
+    }
+#else
+    (void)isa;
+    n = filterScalar(center, range_sq, candidates, 0, 0);
+#endif
+    candidates.passed.resize(n);
+    candidates.passed_dist_sqs.resize(n);
+    return n;
+}
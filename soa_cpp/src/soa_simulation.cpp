@@ -3,12 +3,17 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <stdexcept>
 #include <unordered_map>
 
+#include "geodetic_batch.hpp"
 #include "jsonobj/detection_event.hpp"
 #include "jsonobj/detonation_event.hpp"
+#include "morton_order.hpp"
+#include "position_kernel.hpp"
+#include "range_kernel.hpp"
 #include "route.hpp"
 #include "spatial_hash.hpp"
 
@@ -47,41 +52,66 @@ void SoaSimulation::buildStorage(const jsonobj::Scenario &scenario) {
         total_objects += team.getObjects().size();
     }
 
-    m_storage.object_ids.clear();
-    m_storage.team_ids.clear();
+    m_storage.object_names.clear();
+    m_storage.team_names.clear();
+    m_storage.object_handles.clear();
+    m_storage.team_indices.clear();
     m_storage.roles.clear();
     m_storage.start_secs.clear();
     m_storage.ecef_xs.clear();
     m_storage.ecef_ys.clear();
     m_storage.ecef_zs.clear();
+    m_storage.enu_es.clear();
+    m_storage.enu_ns.clear();
+    m_storage.enu_us.clear();
+    m_storage.prev_ecef_xs.clear();
+    m_storage.prev_ecef_ys.clear();
+    m_storage.prev_ecef_zs.clear();
     m_storage.route_points.clear();
+    m_storage.route_enus.clear();
     m_storage.route_offsets.clear();
     m_storage.route_counts.clear();
     m_storage.segment_end_secs.clear();
+    m_storage.segment_motions.clear();
+    m_storage.segment_motions_enu.clear();
     m_storage.segment_offsets.clear();
     m_storage.segment_counts.clear();
+    m_storage.segment_cursors.clear();
     m_storage.total_duration_secs.clear();
     m_storage.detect_states.clear();
+    m_storage.detection_bits.reset(0);
     m_storage.has_detonated.clear();
+    m_storage.scenario_order.clear();
 
-    m_storage.object_ids.reserve(total_objects);
-    m_storage.team_ids.reserve(total_objects);
+    m_storage.object_handles.reserve(total_objects);
+    m_storage.team_indices.reserve(total_objects);
     m_storage.roles.reserve(total_objects);
     m_storage.start_secs.reserve(total_objects);
     m_storage.ecef_xs.reserve(total_objects);
     m_storage.ecef_ys.reserve(total_objects);
     m_storage.ecef_zs.reserve(total_objects);
+    m_storage.prev_ecef_xs.reserve(total_objects);
+    m_storage.prev_ecef_ys.reserve(total_objects);
+    m_storage.prev_ecef_zs.reserve(total_objects);
     m_storage.route_offsets.reserve(total_objects);
     m_storage.route_counts.reserve(total_objects);
     m_storage.segment_offsets.reserve(total_objects);
     m_storage.segment_counts.reserve(total_objects);
+    m_storage.segment_cursors.reserve(total_objects);
     m_storage.total_duration_secs.reserve(total_objects);
     m_storage.detect_states.reserve(total_objects);
     m_storage.has_detonated.reserve(total_objects);
+    m_storage.scenario_order.reserve(total_objects);
 
     for (const auto &team : scenario.getTeams()) {
+        // IDの文字列はここで1回だけ表に登録し、以降は整数のハンドルで扱います。
+        uint32_t team_index = m_storage.team_names.intern(team.getId());
+        if (team_index > UINT8_MAX) {
+            throw std::runtime_error("scenario: too many teams (at most 256 are supported)");
+        }
         for (const auto &obj : team.getObjects()) {
-            std::vector<RoutePoint> route = buildRoute(obj.getRoute());
+            // 経路点のECEFは位置補間や探知の入力になるため、出力用の変換方法(SOA_GEODETIC)にかかわらずlibmで求めます。
+            std::vector<RoutePoint> route = buildRoute(obj.getRoute(), m_position_isa, TrigKernel::LIBM);
             auto segment_info = buildSegmentTimes(route);
             std::vector<double> segment_ends = std::move(segment_info.first);
             double total_duration = segment_info.second;
@@ -101,12 +131,16 @@ void SoaSimulation::buildStorage(const jsonobj::Scenario &scenario) {
                 m_storage.segment_end_secs.end(),
                 segment_ends.begin(),
                 segment_ends.end());
+            // 区間ごとの移動レコードも同じ添字(segment_offset + 区間番号)で引けるように並べます。
+            std::vector<SegmentMotion> motions = buildSegmentMotions(route, segment_ends);
+            m_storage.segment_motions.insert(m_storage.segment_motions.end(), motions.begin(), motions.end());
             m_storage.segment_offsets.push_back(segment_offset);
             m_storage.segment_counts.push_back(segment_count);
+            m_storage.segment_cursors.push_back(0);
             m_storage.total_duration_secs.push_back(total_duration);
 
-            m_storage.object_ids.push_back(obj.getId());
-            m_storage.team_ids.push_back(team.getId());
+            m_storage.object_handles.push_back(m_storage.object_names.intern(obj.getId()));
+            m_storage.team_indices.push_back(static_cast<uint8_t>(team_index));
             m_storage.roles.push_back(obj.getRole());
             m_storage.start_secs.push_back(static_cast<int>(obj.getStartSec()));
 
@@ -123,8 +157,53 @@ void SoaSimulation::buildStorage(const jsonobj::Scenario &scenario) {
 
             m_storage.detect_states.emplace_back();
             m_storage.has_detonated.push_back(false);
+            m_storage.scenario_order.push_back(static_cast<uint32_t>(m_storage.scenario_order.size()));
         }
     }
+
+    // BITMATRIX方式ではオブジェクト数分の行を用意します。ブロックは探知した相手の分だけ後から増えます。
+    m_storage.detection_backend = m_detection_backend;
+    if (m_detection_backend == DetectionBackend::BITMATRIX) {
+        m_storage.detection_bits.reset(m_storage.object_handles.size());
+    }
+
+    // 経路点全体の中心を原点とする局所座標系を作ります。空間格子はどちらの座標系でもこの接平面でセルを分けます。
+    // 局所座標モードでは、さらに経路点・移動レコード・初期位置をfloatへ変換します。
+    // 変換はここで1回だけ行い、毎秒の更新ではfloatの配列だけを読み書きします。
+    m_storage.coordinate_mode = m_coordinate_mode;
+    m_storage.frame = makeCentroidFrame(m_storage.route_points);
+    if (m_coordinate_mode == CoordinateMode::ENU_F32) {
+        m_storage.route_enus.reserve(m_storage.route_points.size());
+        for (const auto &point : m_storage.route_points) {
+            m_storage.route_enus.push_back(ecefToEnu(m_storage.frame, point.ecef));
+        }
+        m_storage.segment_motions_enu.reserve(m_storage.segment_motions.size());
+        for (const auto &motion : m_storage.segment_motions) {
+            m_storage.segment_motions_enu.push_back(toEnuMotion(m_storage.frame, motion));
+        }
+        m_storage.enu_es.reserve(total_objects);
+        m_storage.enu_ns.reserve(total_objects);
+        m_storage.enu_us.reserve(total_objects);
+        for (size_t i = 0; i < m_storage.object_handles.size(); ++i) {
+            EnuF32 pos = ecefToEnu(
+                m_storage.frame, Ecef{m_storage.ecef_xs[i], m_storage.ecef_ys[i], m_storage.ecef_zs[i]});
+            m_storage.enu_es.push_back(pos.e);
+            m_storage.enu_ns.push_back(pos.n);
+            m_storage.enu_us.push_back(pos.u);
+        }
+        // ECEF配列も局所座標から作り直し、出力される位置をfloatの位置とそろえます。
+        syncEcefFromEnu();
+    }
+
+    // 移動する可能性があるのは、経路を持つ司令官以外のオブジェクトだけです。
+    // 司令官や経路なしのオブジェクトは初期位置のまま動かないので、スケジューラに登録しません。
+    m_scheduler.clear();
+    for (size_t i = 0; i < m_storage.object_handles.size(); ++i) {
+        if (m_storage.roles[i] != jsonobj::Role::COMMANDER && m_storage.route_counts[i] != 0) {
+            m_scheduler.add(i, m_storage.start_secs[i]);
+        }
+    }
+    m_scheduler.rewind();
 }
 
 void SoaSimulation::initialize(const std::string &scenario_path,
@@ -137,11 +216,30 @@ void SoaSimulation::initialize(const std::string &scenario_path,
     m_event_logger.open(event_path);
     m_timeline_logger.open(timeline_path);
     m_scenario = loadScenario(scenario_path);
+    // 命令セットは経路点の変換(buildStorage)でも使うため、先に選びます。
+    m_position_isa = selectPositionKernelIsa();
     buildStorage(m_scenario);
+    // タイムラインの行のうちIDや役割など変わらない部分は、ここで1回だけ組み立てます。
+    m_timeline_logger.prepare(m_storage, *this);
     m_end_sec = 24 * 60 * 60;
     m_detect_range_m = static_cast<int>(m_scenario.getPerformance().getScout().getDetectRangeM());
     m_comm_range_m = static_cast<int>(m_scenario.getPerformance().getScout().getCommRangeM());
     m_bom_range_m = static_cast<int>(m_scenario.getPerformance().getAttacker().getBomRangeM());
+    // 近傍探索は初期位置で1回だけ作り、以降は毎秒動いたオブジェクトの分だけ直します。
+    buildBroadphase();
+    // 各チームから見た相手チームの集合を作ります。シナリオに出てくる自分以外のすべてのチームが相手です。
+    m_enemy_masks.assign(m_storage.team_names.size(), TeamMask{});
+    for (size_t team = 0; team < m_enemy_masks.size(); ++team) {
+        for (size_t other = 0; other < m_enemy_masks.size(); ++other) {
+            if (other != team) {
+                m_enemy_masks[team].set(static_cast<uint8_t>(other));
+            }
+        }
+    }
+    // 並べ替えを有効にしているときは、最初の秒から空間の順に並べておきます。
+    if (m_reorder_interval > 0) {
+        reorderObjects();
+    }
     m_initialized = true;
 }
 
@@ -153,217 +251,308 @@ void SoaSimulation::run() {
     // SoAでは属性ごとの配列を連続走査できるため、1秒ごとの更新を効率的に書けます。
     // ここでは1秒刻みで配列を順に走査しながら更新とログ出力を行います。
     for (int time_sec = 0; time_sec <= m_end_sec; ++time_sec) {
-        std::vector<Ecef> positions = updatePositions(m_storage, time_sec);
-        if (positions.size() != m_storage.object_ids.size()) {
-            throw std::runtime_error("simulation: position count mismatch");
-        }
-        for (size_t i = 0; i < positions.size(); ++i) {
-            m_storage.ecef_xs[i] = positions[i].x;
-            m_storage.ecef_ys[i] = positions[i].y;
-            m_storage.ecef_zs[i] = positions[i].z;
-        }
-
-        std::unordered_map<CellKey, std::vector<int>, CellKeyHash> spatial_hash =
-            buildSpatialHash(m_storage, static_cast<double>(m_detect_range_m));
-
-        for (size_t i = 0; i < m_storage.object_ids.size(); ++i) {
-            if (m_storage.roles[i] == jsonobj::Role::SCOUT) {
-                updateDetectionForScout(time_sec, i, spatial_hash);
-            }
-        }
-
-        for (size_t i = 0; i < m_storage.object_ids.size(); ++i) {
-            if (m_storage.roles[i] == jsonobj::Role::ATTACKER) {
-                emitDetonationForAttacker(time_sec, i);
-            }
+        step(time_sec);
+        if (m_storage.coordinate_mode == CoordinateMode::ENU_F32) {
+            syncEcefFromEnu();
         }
         m_timeline_logger.write(time_sec, m_storage, *this);
     }
 }
 
-std::vector<Ecef> SoaSimulation::updatePositions(const SoaStorage &storage, int time_sec) const {
-    // SoA配列の入力から位置を計算し、副作用なしで結果を返します。
-    // これにより同じ入力なら常に同じ出力になるため、挙動の追跡が容易になります。
-    // SoAの利点は「属性ごとの配列を連続して走査できること」です。
-    // まとめて走査するとCPUキャッシュに乗りやすく、個別オブジェクトを点在アクセスするAoSよりも
-    // メモリアクセスが素直になります。学習用として、このループは関数内で完結させます。
-    // また、分岐(開始前・終了後・区間内など)は同じ順序で並ぶため、CPUの分岐予測が外れにくくなり、
-    // 1件ずつ関数を呼ぶよりも安定した実行時間になりやすいことを意識しています。
-    std::vector<Ecef> positions;
-    positions.resize(storage.object_ids.size());
-
-    for (size_t i = 0; i < storage.object_ids.size(); ++i) {
-        size_t route_count = storage.route_counts[i];
-        if (route_count == 0) {
-            positions[i] = Ecef{0.0, 0.0, 0.0};
-            continue;
-        }
+void SoaSimulation::step(int time_sec) {
+    if (!m_initialized) {
+        throw std::runtime_error("simulation: initialize must be called before step");
+    }
 
-        size_t route_offset = storage.route_offsets[i];
-        const RoutePoint &first = storage.route_points[route_offset];
+    // 一定の秒数ごとに、オブジェクトの配列を今いるセルのMortonコード順に並べ直します。
+    if (m_reorder_interval > 0 && time_sec > 0 && time_sec % m_reorder_interval == 0) {
+        reorderObjects();
+    }
 
-        if (storage.roles[i] == jsonobj::Role::COMMANDER) {
-            positions[i] = first.ecef;
-            continue;
+    updatePositions(time_sec);
+
+    // 空間格子(またはスイープの並び)はupdatePositionsの中で、動いたオブジェクトの分だけ更新済みです。
+    if (m_spatial_check) {
+        if (m_broadphase == Broadphase::SWEEP_AND_PRUNE) {
+            m_sweep.verify(m_storage);
+        } else if (m_broadphase == Broadphase::DYNAMIC_BVH) {
+            m_bvh.verify(m_storage);
+        } else {
+            m_spatial_grid.verify(m_storage);
         }
+    }
 
-        if (time_sec < storage.start_secs[i]) {
-            positions[i] = first.ecef;
-            continue;
+    // イベントはシナリオの順番で出すため、配列の添字ではなくscenario_orderの順に回します。
+    for (uint32_t i : m_storage.scenario_order) {
+        if (m_storage.roles[i] == jsonobj::Role::SCOUT) {
+            updateDetectionForScout(time_sec, i);
         }
+    }
 
-        size_t segment_count = storage.segment_counts[i];
-        if (segment_count == 0) {
-            const RoutePoint &last = storage.route_points[route_offset + route_count - 1];
-            positions[i] = last.ecef;
-            continue;
+    for (uint32_t i : m_storage.scenario_order) {
+        if (m_storage.roles[i] == jsonobj::Role::ATTACKER) {
+            emitDetonationForAttacker(time_sec, i);
         }
+    }
+}
 
-        double elapsed = static_cast<double>(time_sec - storage.start_secs[i]);
-        double total_duration = storage.total_duration_secs[i];
-        if (elapsed >= total_duration) {
-            const RoutePoint &last = storage.route_points[route_offset + route_count - 1];
-            positions[i] = last.ecef;
-            continue;
+void SoaSimulation::reorderObjects() {
+    // セルの幅が決まらないとMortonコードを求められないため、探知範囲が無効なら並べ替えません。
+    if (m_detect_range_m <= 0) {
+        return;
+    }
+    double cell_size = static_cast<double>(m_detect_range_m);
+    computeMortonOrder(m_storage, cell_size, m_reorder_order);
+    bool unchanged = true;
+    for (size_t i = 0; i < m_reorder_order.size(); ++i) {
+        if (m_reorder_order[i] != i) {
+            unchanged = false;
+            break;
         }
+    }
+    if (unchanged) {
+        return;
+    }
+    applyStorageOrder(m_storage, m_reorder_order, m_reorder_new_indices);
+    m_scheduler.remap(m_reorder_new_indices);
+    // 格子のリストもスイープの並びも添字で持っているため、新しい添字で作り直します。
+    buildBroadphase();
+}
 
-        size_t segment_offset = storage.segment_offsets[i];
-        auto begin = storage.segment_end_secs.begin() +
-                     static_cast<std::ptrdiff_t>(segment_offset);
-        auto end = begin + static_cast<std::ptrdiff_t>(segment_count);
-        auto it = std::upper_bound(begin, end, elapsed);
-        size_t segment_index = static_cast<size_t>(std::distance(begin, it));
+void SoaSimulation::buildBroadphase() {
+    if (m_broadphase == Broadphase::SWEEP_AND_PRUNE) {
+        // 軸は経路点の散らばりで決まり、時刻によらないため、作り直しても同じ軸になります。
+        m_sweep.build(m_storage, selectDominantAxis(m_storage.frame, m_storage.route_points));
+        return;
+    }
+    if (m_broadphase == Broadphase::DYNAMIC_BVH) {
+        // 葉は探知距離の1/8だけ太らせます。時速300kmでも十数秒は同じ葉の中に留まるため、再挿入は毎秒ごく一部で済みます。
+        m_bvh.build(m_storage, static_cast<double>(m_detect_range_m) / 8.0);
+        return;
+    }
+    m_spatial_grid.build(m_storage, static_cast<double>(m_detect_range_m));
+}
 
-        if (segment_index >= segment_count) {
-            const RoutePoint &last = storage.route_points[route_offset + route_count - 1];
-            positions[i] = last.ecef;
-            continue;
-        }
+void SoaSimulation::updatePositions(int time_sec) {
+    // 開始時刻を迎えたオブジェクトを移動中リストに加え、移動中のものだけ位置を計算します。
+    // 司令官・開始前・移動完了後のオブジェクトは位置が変わらないので、配列の値をそのまま使います。
+    // SoAの利点は「属性ごとの配列を連続して走査できること」です。
+    // 移動中リストは添字の昇順に並んでいるため、飛び飛びでも配列を前から順に読むアクセスになります。
+    // さらに属性が配列に並んでいるため、SIMD命令で複数体をまとめて補間できます。
+    // 実際の計算はposition_kernel.cppにまとめ、initializeで選んだカーネル(AVX-512/AVX2/スカラー)を使います。
+    if (m_keep_previous_positions && m_storage.coordinate_mode == CoordinateMode::ECEF_F64) {
+        // 位置を書き換える前に、1秒前の位置として写し取ります。
+        // assignは容量が足りていれば再確保しないため、2秒目以降はコピーだけになります。
+        m_storage.prev_ecef_xs.assign(m_storage.ecef_xs.begin(), m_storage.ecef_xs.end());
+        m_storage.prev_ecef_ys.assign(m_storage.ecef_ys.begin(), m_storage.ecef_ys.end());
+        m_storage.prev_ecef_zs.assign(m_storage.ecef_zs.begin(), m_storage.ecef_zs.end());
+    }
 
-        double segment_end = storage.segment_end_secs[segment_offset + segment_index];
-        double segment_start = (segment_index == 0)
-                                   ? 0.0
-                                   : storage.segment_end_secs[segment_offset + segment_index - 1];
-        double segment_duration = segment_end - segment_start;
-        if (segment_duration <= 0.0) {
-            const RoutePoint &target = storage.route_points[route_offset + segment_index + 1];
-            positions[i] = target.ecef;
-            continue;
-        }
-        if (!std::isfinite(segment_duration)) {
-            const RoutePoint &target = storage.route_points[route_offset + segment_index];
-            positions[i] = target.ecef;
-            continue;
-        }
+    m_scheduler.activate(time_sec);
+    const std::vector<size_t> &active = m_scheduler.active();
+    if (m_storage.coordinate_mode == CoordinateMode::ENU_F32) {
+        computePositionsEnuF32(m_storage, time_sec, active.data(), active.size());
+    } else {
+        computePositions(m_position_isa, m_storage, time_sec, active.data(), active.size());
+    }
 
-        double t = (elapsed - segment_start) / segment_duration;
-        const RoutePoint &a = storage.route_points[route_offset + segment_index];
-        const RoutePoint &b = storage.route_points[route_offset + segment_index + 1];
-        positions[i] = Ecef{
-            a.ecef.x + (b.ecef.x - a.ecef.x) * t,
-            a.ecef.y + (b.ecef.y - a.ecef.y) * t,
-            a.ecef.z + (b.ecef.z - a.ecef.z) * t,
-        };
+    // 位置を書き換えたのは移動中リストのオブジェクトだけなので、近傍探索もそれだけ調べ直します。
+    if (m_broadphase == Broadphase::SWEEP_AND_PRUNE) {
+        m_sweep.update(m_storage, active.data(), active.size());
+    } else if (m_broadphase == Broadphase::DYNAMIC_BVH) {
+        m_bvh.update(m_storage, active.data(), active.size());
+    } else {
+        m_spatial_grid.update(m_storage, active.data(), active.size());
     }
 
-    return positions;
+    // 最後の経路点に着いたオブジェクトは、以降ずっと同じ位置なので移動中リストから外します。
+    m_scheduler.retireIf([&](size_t index) {
+        double elapsed = static_cast<double>(time_sec - m_storage.start_secs[index]);
+        return m_storage.segment_counts[index] == 0 || elapsed >= m_storage.total_duration_secs[index];
+    });
 }
 
 void SoaSimulation::updateDetectionForScout(
     int time_sec,
-    size_t scout_index,
-    const std::unordered_map<CellKey, std::vector<int>, CellKeyHash> &spatial_hash) {
+    size_t scout_index) {
     // 探知範囲が無効なら処理を省略し、無駄な計算を避けます。
     if (m_detect_range_m <= 0) {
         return;
     }
 
-    std::unordered_map<std::string, DetectionInfo> current_detected;
-    Ecef scout_pos{m_storage.ecef_xs[scout_index], m_storage.ecef_ys[scout_index], m_storage.ecef_zs[scout_index]};
-    CellKey base = cellKey(scout_pos, static_cast<double>(m_detect_range_m));
-
-    for (int dx = -1; dx <= 1; ++dx) {
-        for (int dy = -1; dy <= 1; ++dy) {
-            for (int dz = -1; dz <= 1; ++dz) {
-                CellKey key{base.x + dx, base.y + dy, base.z + dz};
-                auto it = spatial_hash.find(key);
-                if (it == spatial_hash.end()) {
-                    continue;
-                }
-                for (int index : it->second) {
-                    size_t other_index = static_cast<size_t>(index);
-                    if (other_index == scout_index) {
-                        continue;
-                    }
-                    if (m_storage.team_ids[other_index] == m_storage.team_ids[scout_index]) {
-                        continue;
-                    }
-                    Ecef other_pos{
-                        m_storage.ecef_xs[other_index],
-                        m_storage.ecef_ys[other_index],
-                        m_storage.ecef_zs[other_index],
-                    };
-                    double distance = distanceEcef(scout_pos, other_pos);
-                    if (distance > static_cast<double>(m_detect_range_m)) {
-                        continue;
+    // 作業用の配列は全斥候で使い回します。clearしても容量は残るため、ヒープ確保は起きません。
+    std::vector<DetectionCandidate> &candidates = m_detection_candidates;
+    candidates.clear();
+    RangeCandidates &near = m_range_candidates;
+    near.clear();
+    const TeamMask &enemies = m_enemy_masks[m_storage.team_indices[scout_index]];
+    // 近傍探索(ブロードフェーズ)では距離を測らず、拾った相手の位置を連続した配列へ集めるだけにします。
+    // 距離の判定(ナローフェーズ)は集め終わってから、SIMD命令でまとめて行います。
+    bool enu = m_storage.coordinate_mode == CoordinateMode::ENU_F32;
+    auto gather = [&](size_t other_index) {
+        if (enu) {
+            near.push(static_cast<uint32_t>(other_index), static_cast<double>(m_storage.enu_es[other_index]),
+                      static_cast<double>(m_storage.enu_ns[other_index]),
+                      static_cast<double>(m_storage.enu_us[other_index]));
+        } else {
+            near.push(static_cast<uint32_t>(other_index), m_storage.ecef_xs[other_index],
+                      m_storage.ecef_ys[other_index], m_storage.ecef_zs[other_index]);
+        }
+    };
+
+    if (m_broadphase == Broadphase::SWEEP_AND_PRUNE) {
+        // 軸上の差が探知距離以内の相手を左右に調べます。並びには味方も入っているので、ここでチームを比べます。
+        // 軸上の座標と距離は別々に丸めた値なので、境界ちょうどの相手を落とさないよう1mの余裕を持たせます。
+        m_sweep.forEachNear(scout_index, static_cast<double>(m_detect_range_m) + 1.0, [&](size_t other_index) {
+            if (enemies.test(m_storage.team_indices[other_index])) {
+                gather(other_index);
+            }
+        });
+    } else if (m_broadphase == Broadphase::DYNAMIC_BVH) {
+        // 木には味方も入っているので、ここでチームを比べます。余裕の1mはスイープと同じ理由です。
+        m_bvh.forEachNear(scout_index, static_cast<double>(m_detect_range_m) + 1.0, [&](size_t other_index) {
+            if (enemies.test(m_storage.team_indices[other_index])) {
+                gather(other_index);
+            }
+        });
+    } else {
+        // 空間格子はチームごとにリストを分けているので、相手チームのリストだけをたどります。
+        // 自分や味方はそもそも候補に入らないため、内側のループでチームを比べる必要がありません。
+        // セルは接平面上の正方形なので、調べるのは周囲3x3の9セルです。高さの差は距離判定で考えます。
+        CellKey base = objectCellKey(m_storage, scout_index, static_cast<double>(m_detect_range_m));
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                CellKey key{base.x + dx, base.y + dy};
+                enemies.forEach([&](uint8_t team) {
+                    for (int index : m_spatial_grid.cell(team, key)) {
+                        gather(static_cast<size_t>(index));
                     }
-                    double lat = 0.0;
-                    double lon = 0.0;
-                    double alt = 0.0;
-                    ecefToGeodetic(other_pos, lat, lon, alt);
-                    DetectionInfo info;
-                    info.lat_deg = lat;
-                    info.lon_deg = lon;
-                    info.alt_m = alt;
-                    info.distance_m = static_cast<int>(std::llround(distance));
-                    current_detected.emplace(m_storage.object_ids[other_index], info);
-                }
+                });
             }
         }
     }
 
-    auto &previous_detected = m_storage.detect_states[scout_index];
-    for (const auto &entry : current_detected) {
-        if (previous_detected.find(entry.first) != previous_detected.end()) {
+    // 距離の2乗で比べるので、平方根は範囲内と判定した相手の分しか取りません。
+    // 2乗の判定は少しだけ広めにしておき、通った相手を従来と同じ距離(平方根)で判定し直すことで、
+    // 境界ぎりぎりの相手の扱いも含めて結果を従来の判定とそろえます(局所座標モードのfloatの丸めもこの幅に収まります)。
+    double range = static_cast<double>(m_detect_range_m);
+    Ecef center = enu ? Ecef{static_cast<double>(m_storage.enu_es[scout_index]),
+                             static_cast<double>(m_storage.enu_ns[scout_index]),
+                             static_cast<double>(m_storage.enu_us[scout_index])}
+                      : Ecef{m_storage.ecef_xs[scout_index], m_storage.ecef_ys[scout_index],
+                             m_storage.ecef_zs[scout_index]};
+    size_t passed_count = filterWithinRange(m_position_isa, center, range * range * (1.0 + 1e-5), near);
+    for (size_t k = 0; k < passed_count; ++k) {
+        size_t other_index = near.indices[near.passed[k]];
+        // ECEFモードの距離の2乗はdistanceEcefと同じ演算順序なので、平方根を取れば同じ距離になります。
+        double distance = enu ? distanceBetween(scout_index, other_index) : std::sqrt(near.passed_dist_sqs[k]);
+        if (distance > range) {
             continue;
         }
-        const DetectionInfo &info = entry.second;
-        jsonobj::DetectionEvent event;
-        event.setEventType("detection");
-        event.setDetectionAction(jsonobj::DetectionAction::FOUND);
-        event.setTimeSec(time_sec);
-        event.setScountId(m_storage.object_ids[scout_index]);
-        event.setLatDeg(info.lat_deg);
-        event.setLonDeg(info.lon_deg);
-        event.setAltM(info.alt_m);
-        event.setDistanceM(info.distance_m);
-        event.setDetectId(entry.first);
-        nlohmann::json json_event;
-        jsonobj::to_json(json_event, event);
-        m_event_logger.write(json_event);
-    }
-
-    for (const auto &entry : previous_detected) {
-        if (current_detected.find(entry.first) != current_detected.end()) {
+        DetectionCandidate candidate;
+        candidate.target = m_storage.object_handles[other_index];
+        candidate.order = static_cast<uint32_t>(candidates.size());
+        candidate.object_index = static_cast<uint32_t>(other_index);
+        candidate.distance_m = static_cast<int>(std::llround(distance));
+        candidates.push_back(candidate);
+    }
+
+    if (m_storage.detection_backend == DetectionBackend::BITMATRIX) {
+        diffDetectionBitmatrix(time_sec, scout_index);
+        return;
+    }
+
+    // 見つけた相手をハンドルの昇順に並べます。数体分の整数の並べ替えなので、ハッシュ表を作るより軽く済みます。
+    // 同じハンドルが重なったとき(IDが重複したシナリオ)は、先に見つけたほうだけを残します。
+    std::sort(candidates.begin(), candidates.end(), [](const DetectionCandidate &a, const DetectionCandidate &b) {
+        return a.target != b.target ? a.target < b.target : a.order < b.order;
+    });
+    DetectionState &current = m_current_detected;
+    current.targets.clear();
+    current.contacts.clear();
+    for (const auto &candidate : candidates) {
+        if (!current.targets.empty() && current.targets.back() == candidate.target) {
             continue;
         }
-        const DetectionInfo &info = entry.second;
-        jsonobj::DetectionEvent event;
-        event.setEventType("detection");
-        event.setDetectionAction(jsonobj::DetectionAction::LOST);
-        event.setTimeSec(time_sec);
-        event.setScountId(m_storage.object_ids[scout_index]);
-        event.setLatDeg(info.lat_deg);
-        event.setLonDeg(info.lon_deg);
-        event.setAltM(info.alt_m);
-        event.setDistanceM(info.distance_m);
-        event.setDetectId(entry.first);
-        nlohmann::json json_event;
-        jsonobj::to_json(json_event, event);
-        m_event_logger.write(json_event);
-    }
-
-    previous_detected = std::move(current_detected);
+        // 探知を続けているだけの相手にはイベントを出さないため、ここでは緯度経度を求めずECEFの位置のまま覚えます。
+        // 局所座標モードではここでECEFへ戻します。
+        ContactPayload contact;
+        contact.position = objectPosition(candidate.object_index);
+        contact.distance_m = candidate.distance_m;
+        current.targets.push_back(candidate.target);
+        current.contacts.push_back(contact);
+    }
+
+    // 前の秒と今の秒の状態はどちらも昇順なので、先頭から同時に進めるだけで差分が求まります。
+    // 今だけにいる相手は探知、前だけにいる相手は失探、両方にいる相手は探知を続けているだけです。
+    DetectionState &previous = m_storage.detect_states[scout_index];
+    size_t prev_pos = 0;
+    size_t curr_pos = 0;
+    while (prev_pos < previous.targets.size() || curr_pos < current.targets.size()) {
+        bool has_prev = prev_pos < previous.targets.size();
+        bool has_curr = curr_pos < current.targets.size();
+        if (has_curr && (!has_prev || current.targets[curr_pos] < previous.targets[prev_pos])) {
+            emitDetectionEvent(time_sec, scout_index, jsonobj::DetectionAction::FOUND,
+                               current.targets[curr_pos], current.contacts[curr_pos]);
+            ++curr_pos;
+        } else if (has_prev && (!has_curr || previous.targets[prev_pos] < current.targets[curr_pos])) {
+            emitDetectionEvent(time_sec, scout_index, jsonobj::DetectionAction::LOST,
+                               previous.targets[prev_pos], previous.contacts[prev_pos]);
+            ++prev_pos;
+        } else {
+            ++prev_pos;
+            ++curr_pos;
+        }
+    }
+
+    // 今の秒の結果を前回の状態として写し取ります。斥候ごとの配列の容量はそのまま残るため、ヒープ確保は起きません。
+    previous.targets.assign(current.targets.begin(), current.targets.end());
+    previous.contacts.assign(current.contacts.begin(), current.contacts.end());
+}
+
+void SoaSimulation::diffDetectionBitmatrix(int time_sec, size_t scout_index) {
+    DetectionBitmatrix &bits = m_storage.detection_bits;
+    bits.beginRow(scout_index);
+    // 見つけた順に書き込みます。同じハンドルが重なったときは、setが先に見つけたほうを残します。
+    for (const auto &candidate : m_detection_candidates) {
+        ContactPayload payload;
+        payload.position = objectPosition(candidate.object_index);
+        payload.distance_m = candidate.distance_m;
+        bits.set(scout_index, candidate.target, payload);
+    }
+
+    // ビットの差はハンドルの昇順に取り出されるため、イベントの順番は整列済み配列の突き合わせと同じになります。
+    bits.forEachChange(scout_index, [&](uint32_t target, bool found, const ContactPayload &payload) {
+        emitDetectionEvent(time_sec, scout_index,
+                           found ? jsonobj::DetectionAction::FOUND : jsonobj::DetectionAction::LOST, target, payload);
+    });
+    bits.endRow(scout_index);
+}
+
+void SoaSimulation::emitDetectionEvent(int time_sec,
+                                       size_t scout_index,
+                                       jsonobj::DetectionAction action,
+                                       uint32_t target,
+                                       const ContactPayload &contact) {
+    // 緯度経度はイベントを書き出す相手の分だけ、ここで求めます。
+    // 同じ位置からは常に同じ緯度経度が求まるので、探知した秒に変換していたときと出力は変わりません。
+    double lat = 0.0;
+    double lon = 0.0;
+    double alt = 0.0;
+    ecefToGeodetic(contact.position, lat, lon, alt);
+    jsonobj::DetectionEvent event;
+    event.setEventType("detection");
+    event.setDetectionAction(action);
+    event.setTimeSec(time_sec);
+    event.setScountId(m_storage.objectId(scout_index));
+    event.setLatDeg(lat);
+    event.setLonDeg(lon);
+    event.setAltM(alt);
+    event.setDistanceM(contact.distance_m);
+    event.setDetectId(m_storage.object_names.name(target));
+    nlohmann::json json_event;
+    jsonobj::to_json(json_event, event);
+    m_event_logger.write(json_event);
 }
 
 void SoaSimulation::emitDetonationForAttacker(int time_sec, size_t attacker_index) {
@@ -380,11 +569,7 @@ void SoaSimulation::emitDetonationForAttacker(int time_sec, size_t attacker_inde
         return;
     }
 
-    Ecef pos{
-        m_storage.ecef_xs[attacker_index],
-        m_storage.ecef_ys[attacker_index],
-        m_storage.ecef_zs[attacker_index],
-    };
+    Ecef pos = objectPosition(attacker_index);
     double lat = 0.0;
     double lon = 0.0;
     double alt = 0.0;
@@ -392,7 +577,7 @@ void SoaSimulation::emitDetonationForAttacker(int time_sec, size_t attacker_inde
     jsonobj::DetonationEvent event;
     event.setEventType("detonation");
     event.setTimeSec(time_sec);
-    event.setAttackerId(m_storage.object_ids[attacker_index]);
+    event.setAttackerId(m_storage.objectId(attacker_index));
     event.setLatDeg(lat);
     event.setLonDeg(lon);
     event.setAltM(alt);
@@ -402,3 +587,33 @@ void SoaSimulation::emitDetonationForAttacker(int time_sec, size_t attacker_inde
     m_event_logger.write(json_event);
     m_storage.has_detonated[attacker_index] = true;
 }
+
+Ecef SoaSimulation::objectPosition(size_t index) const {
+    if (m_storage.coordinate_mode == CoordinateMode::ENU_F32) {
+        return enuToEcef(m_storage.frame,
+                         EnuF32{m_storage.enu_es[index], m_storage.enu_ns[index], m_storage.enu_us[index]});
+    }
+    return Ecef{m_storage.ecef_xs[index], m_storage.ecef_ys[index], m_storage.ecef_zs[index]};
+}
+
+double SoaSimulation::distanceBetween(size_t a, size_t b) const {
+    if (m_storage.coordinate_mode == CoordinateMode::ENU_F32) {
+        // 局所座標では差分の値が小さいため、floatのまま計算しても探知範囲の判定には十分な精度です。
+        float de = m_storage.enu_es[a] - m_storage.enu_es[b];
+        float dn = m_storage.enu_ns[a] - m_storage.enu_ns[b];
+        float du = m_storage.enu_us[a] - m_storage.enu_us[b];
+        return static_cast<double>(std::sqrt(de * de + dn * dn + du * du));
+    }
+    return distanceEcef(
+        Ecef{m_storage.ecef_xs[a], m_storage.ecef_ys[a], m_storage.ecef_zs[a]},
+        Ecef{m_storage.ecef_xs[b], m_storage.ecef_ys[b], m_storage.ecef_zs[b]});
+}
+
+void SoaSimulation::syncEcefFromEnu() {
+    for (size_t i = 0; i < m_storage.object_handles.size(); ++i) {
+        Ecef pos = objectPosition(i);
+        m_storage.ecef_xs[i] = pos.x;
+        m_storage.ecef_ys[i] = pos.y;
+        m_storage.ecef_zs[i] = pos.z;
+    }
+}
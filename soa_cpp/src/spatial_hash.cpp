@@ -1,36 +1,212 @@
 #include "spatial_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
 
 size_t CellKeyHash::operator()(const CellKey &key) const {
-    // 3軸を混ぜ合わせることで、セル座標の分布が偏っても衝突を減らします。
-    // 空間ハッシュの詳細はここに閉じ込め、他の箇所からは使いやすい関数だけを見せます。
-    size_t h1 = std::hash<int>{}(key.x);
-    size_t h2 = std::hash<int>{}(key.y);
-    size_t h3 = std::hash<int>{}(key.z);
-    return (h1 * 73856093u) ^ (h2 * 19349663u) ^ (h3 * 83492791u);
+    // 2軸を順に掛け算で混ぜ合わせ、最後に上位ビットを下位へ折り返します。
+    // 単純なXORでは近いセル同士の値が似てしまい、ハッシュ表の同じ位置に集まりやすくなるためです。
+    uint64_t h = static_cast<uint32_t>(key.x);
+    h = h * 0x9E3779B97F4A7C15ull ^ static_cast<uint32_t>(key.y);
+    h *= 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(h ^ (h >> 32));
 }
 
-CellKey cellKey(const Ecef &pos, double cell_size) {
+CellKey cellKey(const LocalFrame &frame, const Ecef &pos, double cell_size) {
+    // 原点からの差分を東・北の向きへ射影します。高さ(上向き)の成分は使いません。
+    double dx = pos.x - frame.origin.x;
+    double dy = pos.y - frame.origin.y;
+    double dz = pos.z - frame.origin.z;
+    double east = frame.east.x * dx + frame.east.y * dy + frame.east.z * dz;
+    double north = frame.north.x * dx + frame.north.y * dy + frame.north.z * dz;
     return CellKey{
-        static_cast<int>(std::floor(pos.x / cell_size)),
-        static_cast<int>(std::floor(pos.y / cell_size)),
-        static_cast<int>(std::floor(pos.z / cell_size)),
+        static_cast<int>(std::floor(east / cell_size)),
+        static_cast<int>(std::floor(north / cell_size)),
     };
 }
 
-std::unordered_map<CellKey, std::vector<int>, CellKeyHash> buildSpatialHash(
-    const SoaStorage &storage,
-    double cell_size) {
-    std::unordered_map<CellKey, std::vector<int>, CellKeyHash> result;
-    if (cell_size <= 0.0) {
-        return result;
+CellKey cellKey(const EnuF32 &pos, double cell_size) {
+    return CellKey{
+        static_cast<int>(std::floor(static_cast<double>(pos.e) / cell_size)),
+        static_cast<int>(std::floor(static_cast<double>(pos.n) / cell_size)),
+    };
+}
+
+CellKey objectCellKey(const SoaStorage &storage, size_t index, double cell_size) {
+    if (storage.coordinate_mode == CoordinateMode::ENU_F32) {
+        return cellKey(EnuF32{storage.enu_es[index], storage.enu_ns[index], storage.enu_us[index]}, cell_size);
+    }
+    return cellKey(storage.frame, Ecef{storage.ecef_xs[index], storage.ecef_ys[index], storage.ecef_zs[index]}, cell_size);
+}
+
+bool selectSpatialCheck() {
+    const char *requested = std::getenv("SOA_SPATIAL_CHECK");
+    return requested != nullptr && std::string(requested) == "1";
+}
+
+void SpatialGrid::build(const SoaStorage &storage, double cell_size) {
+    size_t count = storage.object_handles.size();
+    m_cell_size = cell_size;
+    m_last_crossings = 0;
+    // ハッシュ表の枠数はオブジェクト数の4倍以上の2のべき乗にします。
+    // セル番号は枠数の半分まで振れるので、空のセルが溜まっても掃除までに十分な余裕があります。
+    size_t slot_count = 16;
+    while (slot_count < count * 4) {
+        slot_count *= 2;
+    }
+    m_slots.assign(slot_count, Slot{});
+    m_slot_mask = slot_count - 1;
+    m_cell_capacity = slot_count / 2;
+    m_cells.reserve(m_cell_capacity);
+    m_object_keys.assign(count, CellKey{0, 0});
+    m_object_cells.assign(count, 0);
+    m_next.assign(count, -1);
+    m_prev.assign(count, -1);
+    relinkAll(storage);
+}
+
+void SpatialGrid::update(const SoaStorage &storage, const size_t *indices, size_t count) {
+    m_last_crossings = 0;
+    if (m_cell_size <= 0.0) {
+        return;
+    }
+    for (size_t k = 0; k < count; ++k) {
+        size_t index = indices[k];
+        CellKey key = objectCellKey(storage, index, m_cell_size);
+        // ほとんどのオブジェクトは同じセルにとどまるので、比較だけで次へ進みます。
+        if (key == m_object_keys[index]) {
+            continue;
+        }
+        ++m_last_crossings;
+        // 新しいセルに番号を振れないとき(空のセルが溜まりすぎたとき)は、全体をつなぎ直して空のセルを掃除します。
+        // 表の大きさは変えないので、掃除でもヒープ確保は起きません。
+        uint8_t team = storage.team_indices[index];
+        if (m_cells.size() >= m_cell_capacity && !m_slots[findSlot(team, key)].used) {
+            relinkAll(storage);
+            continue;
+        }
+        unlink(index);
+        m_object_keys[index] = key;
+        link(index, findOrAddCell(team, key));
+    }
+}
+
+SpatialGrid::CellRange SpatialGrid::cell(uint8_t team, const CellKey &key) const {
+    if (m_cells.empty()) {
+        return CellRange{};
+    }
+    const Slot &slot = m_slots[findSlot(team, key)];
+    if (!slot.used) {
+        return CellRange{};
+    }
+    return CellRange{m_next.data(), m_cells[slot.cell].head};
+}
+
+void SpatialGrid::verify(const SoaStorage &storage) const {
+    size_t count = storage.object_handles.size();
+    if (m_cell_size <= 0.0) {
+        return;
+    }
+    if (m_object_keys.size() != count) {
+        throw std::runtime_error("spatial index: object count mismatch");
+    }
+    for (size_t i = 0; i < count; ++i) {
+        CellKey key = objectCellKey(storage, i, m_cell_size);
+        if (!(key == m_object_keys[i])) {
+            throw std::runtime_error("spatial index: stale cell for object " + storage.objectId(i));
+        }
+        const Slot &slot = m_slots[findSlot(storage.team_indices[i], key)];
+        if (!slot.used || slot.cell != m_object_cells[i]) {
+            throw std::runtime_error("spatial index: object " + storage.objectId(i) + " is not in its cell");
+        }
+    }
+    // 各セルのリストをたどり、長さと人数、載っているオブジェクトのセル番号が一致するかを調べます。
+    size_t linked = 0;
+    for (size_t c = 0; c < m_cells.size(); ++c) {
+        size_t length = 0;
+        int prev = -1;
+        for (int index = m_cells[c].head; index != -1; index = m_next[static_cast<size_t>(index)]) {
+            size_t i = static_cast<size_t>(index);
+            if (m_object_cells[i] != c || m_prev[i] != prev || length > count) {
+                throw std::runtime_error("spatial index: broken list in cell " + std::to_string(c));
+            }
+            prev = index;
+            ++length;
+        }
+        if (length != m_cells[c].count) {
+            throw std::runtime_error("spatial index: cell " + std::to_string(c) + " count mismatch");
+        }
+        linked += length;
+    }
+    if (linked != count) {
+        throw std::runtime_error("spatial index: linked object count mismatch");
+    }
+}
+
+size_t SpatialGrid::findSlot(uint8_t team, const CellKey &key) const {
+    // 枠が埋まっていて別のキーなら、隣の枠へ進みます(線形探索法)。
+    // 使う枠は枠数の半分までなので、必ず空き枠か同じキーの枠に行き着きます。
+    // チーム番号には奇数を掛けてから足し、同じセルの別チームが隣り合う枠に固まらないようにします。
+    size_t pos = (CellKeyHash{}(key) + static_cast<size_t>(team) * 0x9E3779B97F4A7C15ull) & m_slot_mask;
+    while (m_slots[pos].used && !(m_slots[pos].team == team && m_slots[pos].key == key)) {
+        pos = (pos + 1) & m_slot_mask;
+    }
+    return pos;
+}
+
+uint32_t SpatialGrid::findOrAddCell(uint8_t team, const CellKey &key) {
+    Slot &slot = m_slots[findSlot(team, key)];
+    if (!slot.used) {
+        slot.key = key;
+        slot.team = team;
+        slot.cell = static_cast<uint32_t>(m_cells.size());
+        slot.used = true;
+        m_cells.push_back(Cell{});
+    }
+    return slot.cell;
+}
+
+void SpatialGrid::link(size_t index, uint32_t cell) {
+    Cell &target = m_cells[cell];
+    m_object_cells[index] = cell;
+    m_prev[index] = -1;
+    m_next[index] = target.head;
+    if (target.head != -1) {
+        m_prev[static_cast<size_t>(target.head)] = static_cast<int>(index);
+    }
+    target.head = static_cast<int>(index);
+    ++target.count;
+}
+
+void SpatialGrid::unlink(size_t index) {
+    Cell &source = m_cells[m_object_cells[index]];
+    int prev = m_prev[index];
+    int next = m_next[index];
+    if (prev != -1) {
+        m_next[static_cast<size_t>(prev)] = next;
+    } else {
+        source.head = next;
+    }
+    if (next != -1) {
+        m_prev[static_cast<size_t>(next)] = prev;
+    }
+    --source.count;
+}
+
+void SpatialGrid::relinkAll(const SoaStorage &storage) {
+    std::fill(m_slots.begin(), m_slots.end(), Slot{});
+    m_cells.clear();
+    if (m_cell_size <= 0.0) {
+        return;
     }
-    // 各オブジェクトをセルに割り当て、近傍探索の候補集合を高速に作ります。
-    // 探知は斥候の責務ですが、空間分割はここで共通処理として提供します。
-    for (size_t i = 0; i < storage.object_ids.size(); ++i) {
-        CellKey key = cellKey(Ecef{storage.ecef_xs[i], storage.ecef_ys[i], storage.ecef_zs[i]}, cell_size);
-        result[key].push_back(static_cast<int>(i));
+    // 先頭へつなぐので、後ろから入れると各セルのリストが添字の昇順になります。
+    for (size_t k = m_object_keys.size(); k > 0; --k) {
+        size_t index = k - 1;
+        CellKey key = objectCellKey(storage, index, m_cell_size);
+        m_object_keys[index] = key;
+        link(index, findOrAddCell(storage.team_indices[index], key));
     }
-    return result;
 }
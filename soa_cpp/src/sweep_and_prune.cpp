@@ -0,0 +1,117 @@
+#include "sweep_and_prune.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/**
+ * @brief ECEFの位置を局所座標系の原点からの差分にし、軸の向きへ射影します。
+ */
+double projectOnAxis(const LocalFrame &frame, const Ecef &pos, SweepAxis axis) {
+    const Ecef &dir = (axis == SweepAxis::EAST) ? frame.east : frame.north;
+    double dx = pos.x - frame.origin.x;
+    double dy = pos.y - frame.origin.y;
+    double dz = pos.z - frame.origin.z;
+    return dir.x * dx + dir.y * dy + dir.z * dz;
+}
+
+} // namespace
+
+SweepAxis selectDominantAxis(const LocalFrame &frame, const std::vector<RoutePoint> &route_points) {
+    if (route_points.empty()) {
+        return SweepAxis::EAST;
+    }
+    double min_east = std::numeric_limits<double>::infinity();
+    double max_east = -std::numeric_limits<double>::infinity();
+    double min_north = std::numeric_limits<double>::infinity();
+    double max_north = -std::numeric_limits<double>::infinity();
+    for (const auto &point : route_points) {
+        double east = projectOnAxis(frame, point.ecef, SweepAxis::EAST);
+        double north = projectOnAxis(frame, point.ecef, SweepAxis::NORTH);
+        min_east = std::min(min_east, east);
+        max_east = std::max(max_east, east);
+        min_north = std::min(min_north, north);
+        max_north = std::max(max_north, north);
+    }
+    return (max_north - min_north > max_east - min_east) ? SweepAxis::NORTH : SweepAxis::EAST;
+}
+
+double sweepCoordinate(const SoaStorage &storage, size_t index, SweepAxis axis) {
+    if (storage.coordinate_mode == CoordinateMode::ENU_F32) {
+        return static_cast<double>(axis == SweepAxis::EAST ? storage.enu_es[index] : storage.enu_ns[index]);
+    }
+    return projectOnAxis(storage.frame, Ecef{storage.ecef_xs[index], storage.ecef_ys[index], storage.ecef_zs[index]},
+                         axis);
+}
+
+void SweepAndPrune::build(const SoaStorage &storage, SweepAxis axis) {
+    size_t count = storage.object_handles.size();
+    m_axis = axis;
+    m_last_swaps = 0;
+    m_entries.resize(count);
+    m_ranks.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        m_entries[i] = Entry{sweepCoordinate(storage, i, axis), static_cast<uint32_t>(i)};
+    }
+    // 最初の1回はまったく並んでいないので、挿入ソートではなく通常のソートを使います。
+    std::sort(m_entries.begin(), m_entries.end(), [](const Entry &a, const Entry &b) {
+        return a.key != b.key ? a.key < b.key : a.index < b.index;
+    });
+    for (size_t pos = 0; pos < count; ++pos) {
+        m_ranks[m_entries[pos].index] = static_cast<uint32_t>(pos);
+    }
+}
+
+void SweepAndPrune::update(const SoaStorage &storage, const size_t *indices, size_t count) {
+    for (size_t k = 0; k < count; ++k) {
+        size_t index = indices[k];
+        m_entries[m_ranks[index]].key = sweepCoordinate(storage, index, m_axis);
+    }
+    insertionSort();
+}
+
+void SweepAndPrune::insertionSort() {
+    m_last_swaps = 0;
+    for (size_t pos = 1; pos < m_entries.size(); ++pos) {
+        Entry entry = m_entries[pos];
+        size_t hole = pos;
+        // 座標が同じときは番号の小さいほうを前にし、並びを1通りに決めます。
+        while (hole > 0 && (entry.key < m_entries[hole - 1].key ||
+                            (entry.key == m_entries[hole - 1].key && entry.index < m_entries[hole - 1].index))) {
+            m_entries[hole] = m_entries[hole - 1];
+            m_ranks[m_entries[hole].index] = static_cast<uint32_t>(hole);
+            --hole;
+        }
+        if (hole != pos) {
+            m_last_swaps += pos - hole;
+            m_entries[hole] = entry;
+            m_ranks[entry.index] = static_cast<uint32_t>(hole);
+        }
+    }
+}
+
+void SweepAndPrune::verify(const SoaStorage &storage) const {
+    size_t count = storage.object_handles.size();
+    if (m_entries.size() != count || m_ranks.size() != count) {
+        throw std::runtime_error("sweep and prune: object count mismatch");
+    }
+    for (size_t i = 0; i < count; ++i) {
+        size_t rank = m_ranks[i];
+        if (rank >= count || m_entries[rank].index != i) {
+            throw std::runtime_error("sweep and prune: object " + storage.objectId(i) + " is not at its rank");
+        }
+        if (m_entries[rank].key != sweepCoordinate(storage, i, m_axis)) {
+            throw std::runtime_error("sweep and prune: stale coordinate for object " + storage.objectId(i));
+        }
+    }
+    for (size_t pos = 1; pos < count; ++pos) {
+        const Entry &prev = m_entries[pos - 1];
+        const Entry &curr = m_entries[pos];
+        if (curr.key < prev.key || (curr.key == prev.key && curr.index < prev.index)) {
+            throw std::runtime_error("sweep and prune: entries are not sorted at " + std::to_string(pos));
+        }
+    }
+}
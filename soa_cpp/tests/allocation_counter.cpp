@@ -0,0 +1,68 @@
+#include "allocation_counter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+// 全体のoperator new/deleteを差し替え、数える設定のスレッドでの確保回数を記録します。
+// 差し替えはこのファイルだけに置きます。テスト本体と同じファイルに置くと、delete(中身はfree)が
+// 標準ライブラリのnewの呼び出し元へインライン展開され、GCCが確保と解放の組み合わせの誤り
+// (-Wmismatched-new-delete)と判断して警告するためです。
+
+namespace {
+
+/**
+ * @brief このスレッドで数えているかどうかと、数えたヒープ確保の回数です。
+ */
+thread_local bool g_count_allocations = false;
+thread_local size_t g_allocation_count = 0;
+
+} // namespace
+
+void beginAllocationCount() {
+    g_allocation_count = 0;
+    g_count_allocations = true;
+}
+
+size_t endAllocationCount() {
+    g_count_allocations = false;
+    return g_allocation_count;
+}
+
+void *operator new(std::size_t size) {
+    if (g_count_allocations) {
+        ++g_allocation_count;
+    }
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+// アライメント指定版のoperator newも数えます。aligned_allocで確保した領域はfreeで解放できます。
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    if (g_count_allocations) {
+        ++g_allocation_count;
+    }
+    std::size_t align = static_cast<std::size_t>(alignment);
+    std::size_t rounded = ((size == 0 ? 1 : size) + align - 1) / align * align;
+    if (void *ptr = std::aligned_alloc(align, rounded)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t /*size*/) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t /*alignment*/) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept {
+    std::free(ptr);
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief このスレッドでのヒープ確保(operator new)を数え始めます。回数は0から数え直します。
+ *
+ * @details イベントログの書き込みスレッドなど、他のスレッドの確保は数えません。
+ */
+void beginAllocationCount();
+
+/**
+ * @brief 数えるのをやめ、beginAllocationCountから数えたヒープ確保の回数を返します。
+ */
+size_t endAllocationCount();
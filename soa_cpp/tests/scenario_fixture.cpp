@@ -0,0 +1,97 @@
+#include "scenario_fixture.hpp"
+
+#include "catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include "soa_simulation.hpp"
+
+namespace {
+
+/**
+ * @brief index番目のオブジェクトが今の秒に探知している相手のハンドルを昇順に返します。
+ *
+ * @details BITMATRIX方式では行のビットをたどり、SORTED_VECTOR方式ではtargetsをそのまま返します。
+ *          どちらの方式でも同じ並びになるため、方式の違うシミュレーションどうしを==で比べられます。
+ */
+std::vector<uint32_t> detectedTargets(const SoaStorage &storage, size_t index) {
+    if (storage.detection_backend != DetectionBackend::BITMATRIX) {
+        return storage.detect_states[index].targets;
+    }
+    std::vector<uint32_t> targets;
+    storage.detection_bits.forEachTarget(index, [&](uint32_t target) { targets.push_back(target); });
+    return targets;
+}
+
+} // namespace
+
+nlohmann::json makePoint(double lat_deg, double lon_deg, double speeds_kph, double alt_m) {
+    return nlohmann::json{{"lat_deg", lat_deg}, {"lon_deg", lon_deg}, {"alt_m", alt_m}, {"speeds_kph", speeds_kph}};
+}
+
+nlohmann::json makeObject(const std::string &id, const std::string &role, int start_sec, nlohmann::json route) {
+    return nlohmann::json{{"id", id}, {"role", role}, {"start_sec", start_sec}, {"route", std::move(route)}};
+}
+
+nlohmann::json makePerformance(int scout_comm_range_m, int detect_range_m, int messenger_comm_range_m) {
+    return nlohmann::json{{"scout", {{"comm_range_m", scout_comm_range_m}, {"detect_range_m", detect_range_m}}},
+                          {"messenger", {{"comm_range_m", messenger_comm_range_m}}},
+                          {"attacker", {{"bom_range_m", 1000}}}};
+}
+
+std::string tempPath(const std::string &file_name) {
+    return (std::filesystem::temp_directory_path() / file_name).string();
+}
+
+std::string writeScenario(const std::string &file_name, const nlohmann::json &performance, nlohmann::json team_a_objects,
+                          nlohmann::json team_b_objects) {
+    nlohmann::json scenario{
+        {"performance", performance},
+        {"teams",
+         {{{"id", "A"}, {"name", "Alpha Team"}, {"objects", std::move(team_a_objects)}},
+          {{"id", "B"}, {"name", "Bravo Team"}, {"objects", std::move(team_b_objects)}}}},
+    };
+    std::string path = tempPath(file_name);
+    std::ofstream out(path);
+    out << scenario.dump();
+    return path;
+}
+
+SoaStorage makeStorage(const std::vector<Ecef> &positions) {
+    SoaStorage storage;
+    storage.team_names.intern("A");
+    storage.team_names.intern("B");
+    for (size_t i = 0; i < positions.size(); ++i) {
+        storage.object_handles.push_back(storage.object_names.intern("obj-" + std::to_string(i)));
+        storage.team_indices.push_back(static_cast<uint8_t>(i % 2));
+        storage.ecef_xs.push_back(positions[i].x);
+        storage.ecef_ys.push_back(positions[i].y);
+        storage.ecef_zs.push_back(positions[i].z);
+    }
+    return storage;
+}
+
+size_t requireSameDetections(SoaSimulation &reference, SoaSimulation &candidate, int seconds) {
+    size_t max_detected = 0;
+    for (int time_sec = 0; time_sec <= seconds; ++time_sec) {
+        reference.step(time_sec);
+        candidate.step(time_sec);
+        const SoaStorage &ref_storage = reference.storage();
+        const SoaStorage &cand_storage = candidate.storage();
+        REQUIRE(cand_storage.scenario_order.size() == ref_storage.scenario_order.size());
+        size_t detected = 0;
+        // 並べ替えで配列の添字が変わっても比べられるよう、シナリオの順番で対応を取ります。
+        for (size_t k = 0; k < ref_storage.scenario_order.size(); ++k) {
+            size_t ref_index = ref_storage.scenario_order[k];
+            size_t cand_index = cand_storage.scenario_order[k];
+            INFO("time_sec=" << time_sec << " object=" << ref_storage.objectId(ref_index));
+            std::vector<uint32_t> expected = detectedTargets(ref_storage, ref_index);
+            REQUIRE(detectedTargets(cand_storage, cand_index) == expected);
+            detected += expected.size();
+        }
+        max_detected = std::max(max_detected, detected);
+    }
+    return max_detected;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "geo.hpp"
+#include "nlohmann/json.hpp"
+#include "soa_storage.hpp"
+
+class SoaSimulation;
+
+/**
+ * @brief シナリオの経路点1つ分のJSONを作ります。
+ */
+nlohmann::json makePoint(double lat_deg, double lon_deg, double speeds_kph, double alt_m = 0.0);
+
+/**
+ * @brief シナリオのオブジェクト1体分のJSONを作ります。
+ */
+nlohmann::json makeObject(const std::string &id, const std::string &role, int start_sec, nlohmann::json route);
+
+/**
+ * @brief 役割ごとの性能のJSONを作ります。攻撃役の爆発範囲はどのテストでも1000mです。
+ */
+nlohmann::json makePerformance(int scout_comm_range_m, int detect_range_m, int messenger_comm_range_m);
+
+/**
+ * @brief 一時ディレクトリの下にfile_nameを置いたときのパスを返します。
+ *
+ * @details テストが書き出すシナリオやログはビルドディレクトリを汚さないよう、すべてここに置きます。
+ *          使い終わったファイルは各テストがstd::removeで消します。
+ */
+std::string tempPath(const std::string &file_name);
+
+/**
+ * @brief 2チーム(A、B)のシナリオを一時ディレクトリのfile_nameへ書き出し、そのパスを返します。
+ */
+std::string writeScenario(const std::string &file_name, const nlohmann::json &performance, nlohmann::json team_a_objects,
+                          nlohmann::json team_b_objects);
+
+/**
+ * @brief ID・チーム・位置だけを持つSoA配列を作ります。IDは「obj-添字」、チームはAとBの交互です。
+ *
+ * @details 局所座標系は原点そのままなので、東はECEFのx軸、北はy軸として扱えます。
+ */
+SoaStorage makeStorage(const std::vector<Ecef> &positions);
+
+/**
+ * @brief 2つのシミュレーションを0秒からseconds秒まで進め、毎秒の探知状態がシナリオの順番で一致することを確かめます。
+ *
+ * @details 探知状態の方式(SORTED_VECTOR/BITMATRIX)が2つで違っていても、探知している相手の集合が等しいことを求めます。
+ *          探知した組の数の最大値を返します。探知が実際に起きていることを呼び出し側で確かめるために使います。
+ */
+size_t requireSameDetections(SoaSimulation &reference, SoaSimulation &candidate, int seconds);
@@ -0,0 +1,151 @@
+#include "catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "aabb_tree.hpp"
+#include "nlohmann/json.hpp"
+#include "scenario_fixture.hpp"
+#include "soa_simulation.hpp"
+#include "soa_storage.hpp"
+
+namespace {
+
+/**
+ * @brief count体分の位置を持つSoA配列を作ります。
+ *
+ * @details 3/4は原点近くの狭い範囲に集め、残りを広い範囲に散らして、密度の偏りがある配置にします。
+ */
+SoaStorage makeClusteredStorage(size_t count) {
+    std::vector<Ecef> positions;
+    for (size_t i = 0; i < count; ++i) {
+        double scale = (i % 4 == 0) ? 800.0 : 9.0;
+        positions.push_back(Ecef{static_cast<double>((i * 37) % 101) * scale, static_cast<double>((i * 53) % 97) * scale,
+                                 static_cast<double>(i % 5) * 10.0});
+    }
+    return makeStorage(positions);
+}
+
+/**
+ * @brief forEachNearで受け取る相手が、平面上で東西・南北ともrange以内の相手をすべて含み、
+ *        range + marginより遠い相手を含まないことを確かめます。
+ */
+void requireCoversBruteForce(const DynamicAabbTree &tree, const SoaStorage &storage, double range, double margin) {
+    for (size_t i = 0; i < storage.object_handles.size(); ++i) {
+        std::vector<size_t> actual;
+        tree.forEachNear(i, range, [&](size_t other) { actual.push_back(other); });
+        std::sort(actual.begin(), actual.end());
+        REQUIRE(std::adjacent_find(actual.begin(), actual.end()) == actual.end());
+        REQUIRE(!std::binary_search(actual.begin(), actual.end(), i));
+        for (size_t j = 0; j < storage.object_handles.size(); ++j) {
+            double de = std::abs(storage.ecef_xs[j] - storage.ecef_xs[i]);
+            double dn = std::abs(storage.ecef_ys[j] - storage.ecef_ys[i]);
+            bool found = std::binary_search(actual.begin(), actual.end(), j);
+            if (j != i && de <= range && dn <= range) {
+                REQUIRE(found);
+            }
+            if (de > range + 2.0 * margin || dn > range + 2.0 * margin) {
+                REQUIRE_FALSE(found);
+            }
+        }
+    }
+}
+
+/**
+ * @brief 大半が港の入口の狭い範囲を行き来し、少数が遠くから港へ向かうシナリオを書き出します。
+ */
+std::string writeHarborScenario() {
+    nlohmann::json team_a_objects = nlohmann::json::array();
+    nlohmann::json team_b_objects = nlohmann::json::array();
+    for (int k = 0; k < 16; ++k) {
+        std::string suffix = (k < 10 ? "0" : "") + std::to_string(k);
+        double offset = 0.002 * k;
+        team_a_objects.push_back(makeObject("A_S" + suffix, k % 2 == 0 ? "scout" : "messenger", 5 * k,
+                                            {makePoint(33.60 + offset, 130.40, 40.0),
+                                             makePoint(33.62, 130.42 - offset, 40.0)}));
+        team_b_objects.push_back(makeObject("B_S" + suffix, k % 3 == 0 ? "scout" : "messenger", 7 * k,
+                                            {makePoint(33.62 - offset, 130.41, 35.0),
+                                             makePoint(33.60, 130.40 + offset, 35.0)}));
+    }
+    for (int k = 0; k < 3; ++k) {
+        team_b_objects.push_back(makeObject("B_F0" + std::to_string(k), "scout", 0,
+                                            {makePoint(33.2 + 0.1 * k, 130.0, 300.0), makePoint(33.6, 130.4, 300.0)}));
+    }
+
+    return writeScenario("soa_aabb_tree_scenario.json", makePerformance(2000, 1500, 3000),
+                         std::move(team_a_objects), std::move(team_b_objects));
+}
+
+} // namespace
+
+TEST_CASE("動的AABB木の探索が、範囲内の相手をすべて拾い、遠い相手を拾わないこと", "[aabb_tree]") {
+    SoaStorage storage = makeClusteredStorage(400);
+    DynamicAabbTree tree;
+    tree.build(storage, 20.0);
+    tree.verify(storage);
+    requireCoversBruteForce(tree, storage, 100.0, 20.0);
+    // 1か所に集まっていても、回転で釣り合いを取るため木は葉の数の対数程度の高さに収まります。
+    REQUIRE(tree.height() <= 2 * static_cast<int>(std::ceil(std::log2(400.0))));
+
+    DynamicAabbTree empty;
+    empty.build(SoaStorage{}, 20.0);
+    REQUIRE(empty.height() == -1);
+}
+
+TEST_CASE("太らせた長方形からはみ出したオブジェクトだけが入れ直されること", "[aabb_tree]") {
+    SoaStorage storage = makeClusteredStorage(400);
+    DynamicAabbTree tree;
+    tree.build(storage, 20.0);
+
+    // 長方形の中での小さな移動では、木は変わりません。
+    std::vector<size_t> moved{1, 2, 3, 100};
+    for (size_t index : moved) {
+        storage.ecef_xs[index] += 5.0;
+        storage.ecef_ys[index] -= 5.0;
+    }
+    tree.update(storage, moved.data(), moved.size());
+    REQUIRE(tree.lastReinsertCount() == 0);
+    tree.verify(storage);
+
+    // はみ出すほど動いたものだけ入れ直されます。
+    storage.ecef_xs[2] += 5000.0;
+    storage.ecef_ys[100] += 30.0;
+    tree.update(storage, moved.data(), moved.size());
+    REQUIRE(tree.lastReinsertCount() == 2);
+    tree.verify(storage);
+    requireCoversBruteForce(tree, storage, 100.0, 20.0);
+
+    // updateに渡さずに動かすと、検証で食い違いが見つかります。
+    storage.ecef_xs[7] += 1.0;
+    REQUIRE_THROWS_AS(tree.verify(storage), std::runtime_error);
+}
+
+TEST_CASE("DYNAMIC_BVH方式の探知状態が、港に密集したシナリオで毎秒GRID方式と一致すること", "[aabb_tree]") {
+    std::string scenario_path = writeHarborScenario();
+    std::string reference_timeline_path = tempPath("soa_aabb_grid_timeline.ndjson");
+    std::string reference_event_path = tempPath("soa_aabb_grid_event.ndjson");
+    std::string candidate_timeline_path = tempPath("soa_aabb_bvh_timeline.ndjson");
+    std::string candidate_event_path = tempPath("soa_aabb_bvh_event.ndjson");
+    SoaSimulation reference;
+    reference.setBroadphase(Broadphase::GRID);
+    reference.setReorderInterval(0);
+    reference.setSpatialCheck(true);
+    reference.initialize(scenario_path, reference_timeline_path, reference_event_path);
+    SoaSimulation candidate;
+    candidate.setBroadphase(Broadphase::DYNAMIC_BVH);
+    candidate.setReorderInterval(0);
+    candidate.setSpatialCheck(true);
+    candidate.initialize(scenario_path, candidate_timeline_path, candidate_event_path);
+
+    size_t max_detected = requireSameDetections(reference, candidate, 20 * 60);
+    REQUIRE(max_detected > 0);
+    std::remove(reference_timeline_path.c_str());
+    std::remove(reference_event_path.c_str());
+    std::remove(candidate_timeline_path.c_str());
+    std::remove(candidate_event_path.c_str());
+    std::remove(scenario_path.c_str());
+}
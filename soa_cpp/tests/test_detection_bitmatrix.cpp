@@ -0,0 +1,198 @@
+#include "catch_amalgamated.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "detection_bitmatrix.hpp"
+#include "nlohmann/json.hpp"
+#include "scenario_fixture.hpp"
+#include "soa_simulation.hpp"
+
+namespace {
+
+/**
+ * @brief forEachChangeで受け取った1件分の変化です。
+ */
+struct Change {
+    uint32_t target;
+    bool found;
+    int distance_m;
+};
+
+std::vector<Change> collectChanges(const DetectionBitmatrix &bits, size_t row) {
+    std::vector<Change> changes;
+    bits.forEachChange(row, [&](uint32_t target, bool found, const ContactPayload &payload) {
+        changes.push_back(Change{target, found, payload.distance_m});
+    });
+    return changes;
+}
+
+ContactPayload makePayload(int distance_m) {
+    ContactPayload payload;
+    payload.distance_m = distance_m;
+    return payload;
+}
+
+/**
+ * @brief 両チームの斥候がすれ違い、探知と失探が何度も起きるシナリオを書き出します。
+ */
+std::string writeCrossingScenario() {
+    nlohmann::json team_a_objects = nlohmann::json::array();
+    nlohmann::json team_b_objects = nlohmann::json::array();
+    for (int k = 0; k < 4; ++k) {
+        double offset = 0.01 * k;
+        team_a_objects.push_back(makeObject("A_S0" + std::to_string(k), "scout", 30 * k,
+                                            {makePoint(33.0 + offset, 130.0, 200.0),
+                                             makePoint(33.5 + offset, 130.0, 200.0)}));
+        team_b_objects.push_back(makeObject("B_S0" + std::to_string(k), "scout", 20 * k,
+                                            {makePoint(33.5 - offset, 130.02, 150.0),
+                                             makePoint(33.0 - offset, 130.02, 150.0)}));
+        team_b_objects.push_back(makeObject("B_M0" + std::to_string(k), "messenger", 0,
+                                            {makePoint(33.1, 130.05 + offset, 100.0),
+                                             makePoint(33.4, 129.95 - offset, 100.0)}));
+    }
+
+    return writeScenario("soa_detection_bitmatrix_scenario.json", makePerformance(2000, 4000, 3000),
+                         std::move(team_a_objects), std::move(team_b_objects));
+}
+
+} // namespace
+
+TEST_CASE("ビットの差から探知・失探をハンドルの昇順に取り出せること", "[detection_bitmatrix]") {
+    DetectionBitmatrix bits;
+    bits.reset(2);
+
+    bits.beginRow(1);
+    REQUIRE(bits.set(1, 130, makePayload(10)));
+    REQUIRE(bits.set(1, 3, makePayload(20)));
+    REQUIRE(bits.set(1, 70, makePayload(30)));
+    // 同じ秒に同じ相手を2回記録したときは、最初の情報が残ります。
+    REQUIRE_FALSE(bits.set(1, 3, makePayload(99)));
+    std::vector<Change> first = collectChanges(bits, 1);
+    REQUIRE(first.size() == 3);
+    REQUIRE(first[0].target == 3);
+    REQUIRE(first[0].distance_m == 20);
+    REQUIRE(first[1].target == 70);
+    REQUIRE(first[2].target == 130);
+    for (const auto &change : first) {
+        REQUIRE(change.found);
+    }
+    bits.endRow(1);
+
+    // 70は探知を続け、3と130を失探し、5を新しく探知します。
+    bits.beginRow(1);
+    bits.set(1, 70, makePayload(31));
+    bits.set(1, 5, makePayload(40));
+    std::vector<Change> second = collectChanges(bits, 1);
+    REQUIRE(second.size() == 3);
+    REQUIRE(second[0].target == 3);
+    REQUIRE_FALSE(second[0].found);
+    // 失探のときは最後に探知した秒の情報を受け取ります。
+    REQUIRE(second[0].distance_m == 20);
+    REQUIRE(second[1].target == 5);
+    REQUIRE(second[1].found);
+    REQUIRE(second[2].target == 130);
+    REQUIRE_FALSE(second[2].found);
+    bits.endRow(1);
+
+    REQUIRE(bits.contains(1, 70));
+    REQUIRE(bits.contains(1, 5));
+    REQUIRE_FALSE(bits.contains(1, 3));
+    REQUIRE_FALSE(bits.contains(0, 70));
+    // 今の秒に探知している相手は、ハンドルの昇順にたどれます。
+    std::vector<uint32_t> targets;
+    bits.forEachTarget(1, [&](uint32_t target) { targets.push_back(target); });
+    REQUIRE(targets == std::vector<uint32_t>{5, 70});
+}
+
+TEST_CASE("同じブロックの探知情報を順不同で記録しても、相手ごとの情報を取り出せること", "[detection_bitmatrix]") {
+    DetectionBitmatrix bits;
+    bits.reset(1);
+
+    // 同じブロック(ハンドル0〜63)の相手を、ハンドルの昇順ではない順に記録します。
+    bits.beginRow(0);
+    bits.set(0, 63, makePayload(630));
+    bits.set(0, 10, makePayload(100));
+    bits.set(0, 0, makePayload(0));
+    bits.set(0, 42, makePayload(420));
+    std::vector<Change> first = collectChanges(bits, 0);
+    REQUIRE(first.size() == 4);
+    for (const auto &change : first) {
+        REQUIRE(change.found);
+        REQUIRE(change.distance_m == static_cast<int>(change.target) * 10);
+    }
+    bits.endRow(0);
+
+    // 10と63を失探し、42を続け、7を新しく探知します。失探は最後に探知した秒の情報です。
+    bits.beginRow(0);
+    bits.set(0, 42, makePayload(421));
+    bits.set(0, 7, makePayload(70));
+    bits.set(0, 0, makePayload(1));
+    std::vector<Change> second = collectChanges(bits, 0);
+    REQUIRE(second.size() == 3);
+    REQUIRE(second[0].target == 7);
+    REQUIRE(second[0].found);
+    REQUIRE(second[0].distance_m == 70);
+    REQUIRE(second[1].target == 10);
+    REQUIRE_FALSE(second[1].found);
+    REQUIRE(second[1].distance_m == 100);
+    REQUIRE(second[2].target == 63);
+    REQUIRE_FALSE(second[2].found);
+    REQUIRE(second[2].distance_m == 630);
+    bits.endRow(0);
+}
+
+TEST_CASE("探知がなくなったブロックは捨てられ、メモリが探知中の組の数に比例すること", "[detection_bitmatrix]") {
+    DetectionBitmatrix bits;
+    bits.reset(1);
+
+    bits.beginRow(0);
+    bits.set(0, 1, makePayload(1));
+    bits.set(0, 1000000, makePayload(2));
+    bits.endRow(0);
+    // 離れた2つのハンドルでも、使うのはそれぞれを含む2ブロックだけです。
+    REQUIRE(bits.blockCount() == 2);
+    // 探知情報はブロックごとに64個分ではなく、探知した組の分だけを持ちます。
+    REQUIRE(bits.payloadCount() == 2);
+
+    bits.beginRow(0);
+    bits.set(0, 1, makePayload(1));
+    REQUIRE(collectChanges(bits, 0).size() == 1);
+    bits.endRow(0);
+    REQUIRE(bits.blockCount() == 1);
+    // 残ったブロックには、前の秒と今の秒に探知した1組分ずつの情報があります。
+    REQUIRE(bits.payloadCount() == 2);
+
+    // 何も探知しない秒は、最後のブロックの失探を出した後にブロックがなくなります。
+    bits.beginRow(0);
+    REQUIRE(collectChanges(bits, 0).size() == 1);
+    bits.endRow(0);
+    REQUIRE(bits.blockCount() == 0);
+}
+
+TEST_CASE("BITMATRIX方式の探知状態が毎秒SORTED_VECTOR方式と一致すること", "[detection_bitmatrix]") {
+    std::string scenario_path = writeCrossingScenario();
+    std::string reference_timeline_path = tempPath("soa_detection_sorted_timeline.ndjson");
+    std::string reference_event_path = tempPath("soa_detection_sorted_event.ndjson");
+    std::string candidate_timeline_path = tempPath("soa_detection_bits_timeline.ndjson");
+    std::string candidate_event_path = tempPath("soa_detection_bits_event.ndjson");
+    SoaSimulation reference;
+    reference.setDetectionBackend(DetectionBackend::SORTED_VECTOR);
+    reference.setSpatialCheck(true);
+    reference.initialize(scenario_path, reference_timeline_path, reference_event_path);
+    SoaSimulation candidate;
+    candidate.setDetectionBackend(DetectionBackend::BITMATRIX);
+    candidate.setSpatialCheck(true);
+    candidate.initialize(scenario_path, candidate_timeline_path, candidate_event_path);
+
+    // 探知中の相手の集合が両方向に一致すること(多くも少なくもないこと)を毎秒確かめます。
+    size_t max_detected = requireSameDetections(reference, candidate, 20 * 60);
+    REQUIRE(candidate.storage().detection_backend == DetectionBackend::BITMATRIX);
+    REQUIRE(max_detected > 0);
+    std::remove(reference_timeline_path.c_str());
+    std::remove(reference_event_path.c_str());
+    std::remove(candidate_timeline_path.c_str());
+    std::remove(candidate_event_path.c_str());
+    std::remove(scenario_path.c_str());
+}
@@ -0,0 +1,98 @@
+#include "catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "geo.hpp"
+
+namespace {
+
+/**
+ * @brief 2つの変換結果の差を、地表での距離(メートル)に直した最大値です。
+ */
+struct GeodeticError {
+    double horizontal_m = 0.0;
+    double alt_m = 0.0;
+};
+
+/**
+ * @brief 緯度・経度・高度の格子点をECEFへ変換し、methodと反復法(ITERATIVE)の結果の差の最大値を求めます。
+ *
+ * @details 緯度の差は子午線方向、経度の差は緯線方向の長さへ、地球の半径で近似して直します。
+ */
+GeodeticError maxErrorAgainstIterative(GeodeticMethod method, double min_alt_m, double max_alt_m) {
+    constexpr double kMetersPerRadian = 6378137.0;
+    GeodeticError error;
+    for (double lat = -89.5; lat <= 89.5; lat += 0.75) {
+        for (double lon = -179.0; lon <= 180.0; lon += 23.0) {
+            for (double alt = min_alt_m; alt <= max_alt_m; alt += (max_alt_m - min_alt_m) / 7.0) {
+                Ecef pos = geodeticToEcef(lat, lon, alt);
+                double ref_lat = 0.0;
+                double ref_lon = 0.0;
+                double ref_alt = 0.0;
+                ecefToGeodetic(GeodeticMethod::ITERATIVE, pos, ref_lat, ref_lon, ref_alt);
+                double fast_lat = 0.0;
+                double fast_lon = 0.0;
+                double fast_alt = 0.0;
+                ecefToGeodetic(method, pos, fast_lat, fast_lon, fast_alt);
+
+                double dlat_m = (fast_lat - ref_lat) * M_PI / 180.0 * kMetersPerRadian;
+                double dlon_m = (fast_lon - ref_lon) * M_PI / 180.0 * kMetersPerRadian * std::cos(ref_lat * M_PI / 180.0);
+                error.horizontal_m = std::max(error.horizontal_m, std::sqrt(dlat_m * dlat_m + dlon_m * dlon_m));
+                error.alt_m = std::max(error.alt_m, std::abs(fast_alt - ref_alt));
+            }
+        }
+    }
+    return error;
+}
+
+} // namespace
+
+TEST_CASE("高速な緯度経度変換が、地表付近で反復法と0.1mm未満の差に収まること", "[geo]") {
+    // シナリオで使う高度(海面下の潜航から高高度の航空機まで)の範囲です。
+    for (GeodeticMethod method : {GeodeticMethod::BOWRING, GeodeticMethod::VERMEILLE}) {
+        INFO("method=" << geodeticMethodName(method));
+        GeodeticError error = maxErrorAgainstIterative(method, -1000.0, 50000.0);
+        REQUIRE(error.horizontal_m < 1e-4);
+        REQUIRE(error.alt_m < 1e-4);
+    }
+}
+
+TEST_CASE("閉じた式(VERMEILLE)は宇宙の高さでも反復法と一致すること", "[geo]") {
+    // Bowringの式は高度が上がるほど誤差が増えますが、閉じた式は近似を含まないため、静止軌道の高さでも差は丸め誤差程度です。
+    GeodeticError error = maxErrorAgainstIterative(GeodeticMethod::VERMEILLE, 100000.0, 36000000.0);
+    REQUIRE(error.horizontal_m < 1e-4);
+    REQUIRE(error.alt_m < 1e-4);
+}
+
+TEST_CASE("経度と極・赤道の扱いが反復法と同じになること", "[geo]") {
+    for (GeodeticMethod method : {GeodeticMethod::BOWRING, GeodeticMethod::VERMEILLE}) {
+        INFO("method=" << geodeticMethodName(method));
+        // 経度は同じatan2で求めるため、ビット単位で一致します。
+        Ecef pos = geodeticToEcef(33.6, 130.4, 120.0);
+        double ref_lat = 0.0;
+        double ref_lon = 0.0;
+        double ref_alt = 0.0;
+        ecefToGeodetic(GeodeticMethod::ITERATIVE, pos, ref_lat, ref_lon, ref_alt);
+        double lat = 0.0;
+        double lon = 0.0;
+        double alt = 0.0;
+        ecefToGeodetic(method, pos, lat, lon, alt);
+        REQUIRE(lon == ref_lon);
+
+        // 赤道上と北極の真上です。
+        ecefToGeodetic(method, Ecef{6378137.0 + 100.0, 0.0, 0.0}, lat, lon, alt);
+        REQUIRE(std::abs(lat) < 1e-12);
+        REQUIRE(std::abs(alt - 100.0) < 1e-6);
+        ecefToGeodetic(method, geodeticToEcef(90.0, 0.0, 250.0), lat, lon, alt);
+        REQUIRE(std::abs(lat - 90.0) < 1e-9);
+        REQUIRE(std::abs(alt - 250.0) < 1e-4);
+    }
+}
+
+TEST_CASE("SOA_GEODETICの名前と変換方法が対応していること", "[geo]") {
+    REQUIRE(std::string(geodeticMethodName(GeodeticMethod::ITERATIVE)) == "iterative");
+    REQUIRE(std::string(geodeticMethodName(GeodeticMethod::BOWRING)) == "bowring");
+    REQUIRE(std::string(geodeticMethodName(GeodeticMethod::VERMEILLE)) == "vermeille");
+}
@@ -0,0 +1,125 @@
+#include "catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "geo.hpp"
+#include "geodetic_batch.hpp"
+
+namespace {
+
+/**
+ * @brief 全球の緯度経度と、海面下から高高度までの高度を組み合わせた点を作ります。
+ *
+ * @details SIMDの幅(4)で割り切れない件数にし、端数をスカラーで処理する部分も通るようにします。
+ *          経度±180度、緯度±90度、赤道・本初子午線の上の点も含めます。
+ */
+void makeGeodeticPoints(std::vector<double> &lats, std::vector<double> &lons, std::vector<double> &alts) {
+    for (double lat = -90.0; lat <= 90.0; lat += 7.5) {
+        for (double lon = -180.0; lon <= 180.0; lon += 22.5) {
+            lats.push_back(lat);
+            lons.push_back(lon);
+            alts.push_back(-1000.0 + std::fmod(std::abs(lat * 37.0 + lon * 11.0), 51000.0));
+        }
+    }
+    lats.push_back(33.6);
+    lons.push_back(130.4);
+    alts.push_back(0.0);
+}
+
+} // namespace
+
+TEST_CASE("ITERATIVEとLIBMのまとめての変換が、1点ずつの変換とビット単位で一致すること", "[geodetic_batch]") {
+    std::vector<double> lats;
+    std::vector<double> lons;
+    std::vector<double> alts;
+    makeGeodeticPoints(lats, lons, alts);
+    size_t count = lats.size();
+    REQUIRE(count % 4 != 0);
+
+    std::vector<double> xs(count);
+    std::vector<double> ys(count);
+    std::vector<double> zs(count);
+    geodeticToEcefBatch(selectPositionKernelIsa(), TrigKernel::LIBM, lats.data(), lons.data(), alts.data(),
+                        count, xs.data(), ys.data(), zs.data());
+    std::vector<double> out_lats(count);
+    std::vector<double> out_lons(count);
+    std::vector<double> out_alts(count);
+    ecefToGeodeticBatch(selectPositionKernelIsa(), GeodeticMethod::ITERATIVE, xs.data(), ys.data(), zs.data(), count,
+                        out_lats.data(), out_lons.data(), out_alts.data());
+
+    for (size_t i = 0; i < count; ++i) {
+        Ecef pos = geodeticToEcef(lats[i], lons[i], alts[i]);
+        REQUIRE(std::memcmp(&pos.x, &xs[i], sizeof(double)) == 0);
+        REQUIRE(std::memcmp(&pos.y, &ys[i], sizeof(double)) == 0);
+        REQUIRE(std::memcmp(&pos.z, &zs[i], sizeof(double)) == 0);
+        double lat = 0.0;
+        double lon = 0.0;
+        double alt = 0.0;
+        ecefToGeodetic(GeodeticMethod::ITERATIVE, pos, lat, lon, alt);
+        REQUIRE(std::memcmp(&lat, &out_lats[i], sizeof(double)) == 0);
+        REQUIRE(std::memcmp(&lon, &out_lons[i], sizeof(double)) == 0);
+        REQUIRE(std::memcmp(&alt, &out_alts[i], sizeof(double)) == 0);
+    }
+}
+
+TEST_CASE("SIMD版(BOWRING・POLYNOMIAL)のまとめての変換が、スカラー版との差を丸め誤差程度に収めること", "[geodetic_batch]") {
+    if (!isPositionKernelIsaSupported(PositionKernelIsa::AVX2)) {
+        SKIP("AVX2に対応していないCPUです");
+    }
+    std::vector<double> lats;
+    std::vector<double> lons;
+    std::vector<double> alts;
+    makeGeodeticPoints(lats, lons, alts);
+    size_t count = lats.size();
+
+    // sin/cosを多項式で近似したECEFは、libmで求めた値との差が1e-8m未満です。
+    std::vector<double> xs(count);
+    std::vector<double> ys(count);
+    std::vector<double> zs(count);
+    geodeticToEcefBatch(PositionKernelIsa::AVX2, TrigKernel::POLYNOMIAL, lats.data(), lons.data(), alts.data(), count,
+                        xs.data(), ys.data(), zs.data());
+    for (size_t i = 0; i < count; ++i) {
+        INFO("lat=" << lats[i] << " lon=" << lons[i] << " alt=" << alts[i]);
+        Ecef ref = geodeticToEcef(lats[i], lons[i], alts[i]);
+        REQUIRE(distanceEcef(ref, Ecef{xs[i], ys[i], zs[i]}) < 1e-8);
+    }
+
+    // atan2を多項式で近似した緯度経度は、スカラー版のBOWRINGとの差が1e-12度未満です。
+    // 経度±180度の点は、どちらの向き(+180/-180)で表しても同じ位置なので、差を360度で折り返して比べます。
+    std::vector<double> out_lats(count);
+    std::vector<double> out_lons(count);
+    std::vector<double> out_alts(count);
+    ecefToGeodeticBatch(PositionKernelIsa::AVX2, GeodeticMethod::BOWRING, xs.data(), ys.data(), zs.data(), count,
+                        out_lats.data(), out_lons.data(), out_alts.data());
+    for (size_t i = 0; i < count; ++i) {
+        INFO("lat=" << lats[i] << " lon=" << lons[i] << " alt=" << alts[i]);
+        double lat = 0.0;
+        double lon = 0.0;
+        double alt = 0.0;
+        ecefToGeodetic(GeodeticMethod::BOWRING, Ecef{xs[i], ys[i], zs[i]}, lat, lon, alt);
+        REQUIRE(std::abs(out_lats[i] - lat) < 1e-12);
+        double dlon = std::abs(out_lons[i] - lon);
+        REQUIRE(std::min(dlon, std::abs(dlon - 360.0)) < 1e-12);
+        REQUIRE(std::abs(out_alts[i] - alt) < 1e-6);
+        // 元の緯度経度高度とも、地表付近の精度(0.1mm)で一致します。
+        REQUIRE(std::abs(out_lats[i] - lats[i]) < 1e-9);
+        REQUIRE(std::abs(out_alts[i] - alts[i]) < 1e-4);
+    }
+
+    // 地球の中心のような扱いにくい点はスカラー版に任せるため、反復法と同じ値になります。
+    std::vector<double> cx{0.0, 6378137.0, 0.0, 0.0, 1.0};
+    std::vector<double> cy{0.0, 0.0, 6378137.0, 0.0, 0.0};
+    std::vector<double> cz{0.0, 0.0, 0.0, 6356752.0, 0.0};
+    std::vector<double> c_lats(5);
+    std::vector<double> c_lons(5);
+    std::vector<double> c_alts(5);
+    ecefToGeodeticBatch(PositionKernelIsa::AVX2, GeodeticMethod::BOWRING, cx.data(), cy.data(), cz.data(), 5,
+                        c_lats.data(), c_lons.data(), c_alts.data());
+    REQUIRE(c_lats[0] == 0.0);
+    REQUIRE(c_alts[0] == -6378137.0);
+    REQUIRE(std::abs(c_lons[2] - 90.0) < 1e-12);
+    REQUIRE(std::abs(c_lats[3] - 90.0) < 1e-9);
+}
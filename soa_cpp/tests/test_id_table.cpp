@@ -0,0 +1,31 @@
+#include "catch_amalgamated.hpp"
+
+#include <string>
+
+#include "id_table.hpp"
+
+TEST_CASE("IDの文字列に0から順にハンドルが振られ、元の文字列へ戻せること", "[id_table]") {
+    IdTable table;
+    uint32_t alpha = table.intern("alpha-scout-object");
+    uint32_t bravo = table.intern("bravo-scout-object");
+
+    REQUIRE(alpha == 0);
+    REQUIRE(bravo == 1);
+    REQUIRE(table.size() == 2);
+    REQUIRE(table.name(alpha) == "alpha-scout-object");
+    REQUIRE(table.name(bravo) == "bravo-scout-object");
+}
+
+TEST_CASE("同じ文字列を再登録すると同じハンドルが返ること", "[id_table]") {
+    IdTable table;
+    uint32_t first = table.intern("A");
+    table.intern("B");
+    uint32_t again = table.intern(std::string("A"));
+
+    REQUIRE(again == first);
+    REQUIRE(table.size() == 2);
+
+    table.clear();
+    REQUIRE(table.size() == 0);
+    REQUIRE(table.intern("B") == 0);
+}
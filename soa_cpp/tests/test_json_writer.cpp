@@ -0,0 +1,91 @@
+#include "catch_amalgamated.hpp"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "json_writer.hpp"
+#include "nlohmann/json.hpp"
+
+namespace {
+
+/**
+ * @brief JsonBufferで追加した内容を文字列として取り出します。
+ */
+std::string contents(const JsonBuffer &buffer) {
+    return std::string(buffer.data(), buffer.size());
+}
+
+} // namespace
+
+TEST_CASE("浮動小数点数の書式がnlohmann::jsonのdump()と一致すること", "[json_writer]") {
+    std::vector<double> values{0.0,
+                               -0.0,
+                               1.0,
+                               -1.0,
+                               0.1,
+                               100.0,
+                               1e-4,
+                               1e-5,
+                               123456789012345.0,
+                               1e15,
+                               1e16,
+                               1e300,
+                               5e-324,
+                               33.6,
+                               130.4,
+                               -1234.5678,
+                               std::numeric_limits<double>::max(),
+                               std::numeric_limits<double>::quiet_NaN(),
+                               std::numeric_limits<double>::infinity()};
+    // シナリオの範囲の緯度経度と高度に近い値も、乱数でたくさん確かめます。乱数の種は固定です。
+    std::mt19937 rng(20240612u);
+    std::uniform_real_distribution<double> lat(-90.0, 90.0);
+    std::uniform_real_distribution<double> alt(-1000.0, 50000.0);
+    for (int i = 0; i < 2000; ++i) {
+        values.push_back(lat(rng));
+        values.push_back(alt(rng));
+    }
+
+    JsonBuffer buffer;
+    for (double value : values) {
+        INFO("value=" << value);
+        buffer.clear();
+        buffer.appendDouble(value);
+        REQUIRE(contents(buffer) == nlohmann::json(value).dump());
+    }
+}
+
+TEST_CASE("文字列のエスケープと整数の書式がnlohmann::jsonのdump()と一致すること", "[json_writer]") {
+    std::string control;
+    for (char c = 0x01; c < 0x20; ++c) {
+        control.push_back(c);
+    }
+    for (const std::string &text : {std::string(""), std::string("alpha-scout-01"), std::string("quote\"back\\slash"),
+                                    std::string("tab\tnew\nline\r"), std::string("日本語のID"), control,
+                                    std::string("nul\0end", 7)}) {
+        JsonBuffer buffer;
+        buffer.appendString(text);
+        REQUIRE(contents(buffer) == nlohmann::json(text).dump());
+    }
+    for (int64_t value : {int64_t{0}, int64_t{-1}, int64_t{86400}, std::numeric_limits<int64_t>::min(),
+                          std::numeric_limits<int64_t>::max()}) {
+        JsonBuffer buffer;
+        buffer.appendInt(value);
+        REQUIRE(contents(buffer) == nlohmann::json(value).dump());
+    }
+}
+
+TEST_CASE("clearで中身だけを消し、容量は使い回すこと", "[json_writer]") {
+    JsonBuffer buffer;
+    buffer.appendRaw("{\"positions\":[");
+    buffer.appendDouble(33.6);
+    buffer.appendRaw(']');
+    REQUIRE(contents(buffer) == "{\"positions\":[33.6]");
+    size_t capacity = buffer.capacity();
+    buffer.clear();
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(buffer.capacity() == capacity);
+}
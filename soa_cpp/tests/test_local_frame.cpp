@@ -0,0 +1,117 @@
+#include "catch_amalgamated.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "geo.hpp"
+#include "local_frame.hpp"
+#include "nlohmann/json.hpp"
+#include "scenario_fixture.hpp"
+#include "soa_simulation.hpp"
+
+namespace {
+
+/**
+ * @brief 約200km四方を斥候と伝令が行き交う2チームのシナリオを書き出します。
+ *
+ * @details 原点から最も遠い経路点は100km以上離しておき、floatの丸め誤差が大きくなる位置も検証に含めます。
+ */
+std::string writeWideAreaScenario() {
+    nlohmann::json team_a_objects = nlohmann::json::array();
+    nlohmann::json team_b_objects = nlohmann::json::array();
+    team_a_objects.push_back(makeObject("A_C00", "commander", 0, {makePoint(33.0, 129.0, 0.0, 0.0)}));
+    team_b_objects.push_back(makeObject("B_C00", "commander", 0, {makePoint(34.8, 131.0, 0.0, 0.0)}));
+    for (int k = 0; k < 3; ++k) {
+        double offset = 0.02 * k;
+        team_a_objects.push_back(makeObject("A_S0" + std::to_string(k), "scout", 10 * k,
+                                            {makePoint(33.0 + offset, 129.0, 300.0, 150.0),
+                                             makePoint(34.8 - offset, 131.0, 300.0, 3000.0),
+                                             makePoint(33.0, 131.0, 120.0, 20.0)}));
+        team_b_objects.push_back(makeObject("B_M0" + std::to_string(k), "messenger", 5 * k,
+                                            {makePoint(34.8, 129.0 + offset, 250.0, 10.0),
+                                             makePoint(33.0, 131.0 - offset, 250.0, 10.0)}));
+    }
+    team_b_objects.push_back(makeObject("B_A00", "attacker", 0,
+                                        {makePoint(34.8, 131.0, 200.0, 0.0), makePoint(33.0, 129.0, 200.0, 0.0)}));
+
+    return writeScenario("soa_local_frame_scenario.json", makePerformance(5000, 10000, 8000),
+                         std::move(team_a_objects), std::move(team_b_objects));
+}
+
+} // namespace
+
+TEST_CASE("局所座標系の軸が直交する単位ベクトルで、上向きが地表の法線になること", "[local_frame]") {
+    LocalFrame frame = makeLocalFrame(33.9, 130.0);
+    auto dot = [](const Ecef &a, const Ecef &b) { return a.x * b.x + a.y * b.y + a.z * b.z; };
+    REQUIRE(dot(frame.east, frame.east) == Catch::Approx(1.0));
+    REQUIRE(dot(frame.north, frame.north) == Catch::Approx(1.0));
+    REQUIRE(dot(frame.up, frame.up) == Catch::Approx(1.0));
+    REQUIRE(std::abs(dot(frame.east, frame.north)) < 1e-12);
+    REQUIRE(std::abs(dot(frame.east, frame.up)) < 1e-12);
+    REQUIRE(std::abs(dot(frame.north, frame.up)) < 1e-12);
+
+    // 原点の真上1000mは、局所座標ではほぼ(0, 0, 1000)になります。
+    EnuF32 above = ecefToEnu(frame, geodeticToEcef(33.9, 130.0, 1000.0));
+    REQUIRE(std::abs(above.e) < 1e-3f);
+    REQUIRE(std::abs(above.n) < 1e-3f);
+    REQUIRE(above.u == Catch::Approx(1000.0f).margin(1e-3f));
+}
+
+TEST_CASE("原点から150km以内ならECEFと局所座標の往復誤差が数cmに収まること", "[local_frame]") {
+    LocalFrame frame = makeLocalFrame(33.9, 130.0);
+    for (double dlat : {-1.3, -0.4, 0.0, 0.7, 1.3}) {
+        for (double dlon : {-1.5, -0.2, 0.0, 0.9, 1.5}) {
+            Ecef pos = geodeticToEcef(33.9 + dlat, 130.0 + dlon, 5000.0);
+            Ecef back = enuToEcef(frame, ecefToEnu(frame, pos));
+            INFO("dlat=" << dlat << " dlon=" << dlon);
+            REQUIRE(distanceEcef(pos, back) < 0.03);
+        }
+    }
+}
+
+TEST_CASE("ENU_F32モードの位置とイベントがECEF_F64モードと許容誤差内で一致すること", "[local_frame]") {
+    std::string scenario_path = writeWideAreaScenario();
+    std::string reference_timeline_path = tempPath("soa_local_frame_ecef_timeline.ndjson");
+    std::string reference_event_path = tempPath("soa_local_frame_ecef_event.ndjson");
+    std::string candidate_timeline_path = tempPath("soa_local_frame_enu_timeline.ndjson");
+    std::string candidate_event_path = tempPath("soa_local_frame_enu_event.ndjson");
+    SoaSimulation reference;
+    reference.setCoordinateMode(CoordinateMode::ECEF_F64);
+    reference.setReorderInterval(0);
+    reference.setSpatialCheck(true);
+    reference.initialize(scenario_path, reference_timeline_path, reference_event_path);
+    SoaSimulation candidate;
+    candidate.setCoordinateMode(CoordinateMode::ENU_F32);
+    candidate.setReorderInterval(0);
+    candidate.setSpatialCheck(true);
+    candidate.initialize(scenario_path, candidate_timeline_path, candidate_event_path);
+
+    double max_error_m = 0.0;
+    for (int time_sec = 0; time_sec <= 4 * 60 * 60; ++time_sec) {
+        reference.step(time_sec);
+        candidate.step(time_sec);
+        for (size_t i = 0; i < reference.storage().object_handles.size(); ++i) {
+            max_error_m = std::max(max_error_m,
+                                   distanceEcef(reference.objectPosition(i), candidate.objectPosition(i)));
+        }
+    }
+    INFO("max position error = " << max_error_m << " m");
+    // floatの有効桁(約7桁)と原点からの距離(約150km)から、誤差は数cm程度に収まります。
+    REQUIRE(max_error_m < 0.1);
+
+    // 探知・失探は毎秒の距離判定なので、範囲の境界を数cmの差でまたぐ時刻が1秒ずれることはあり得ます。
+    // このシナリオでは境界をゆっくりまたぐ組がないため、探知状態は最後まで一致します。
+    for (size_t i = 0; i < reference.storage().object_handles.size(); ++i) {
+        const auto &ref_state = reference.storage().detect_states[i];
+        const auto &cand_state = candidate.storage().detect_states[i];
+        REQUIRE(ref_state.targets == cand_state.targets);
+    }
+    REQUIRE(candidate.storage().has_detonated == reference.storage().has_detonated);
+    std::remove(reference_timeline_path.c_str());
+    std::remove(reference_event_path.c_str());
+    std::remove(candidate_timeline_path.c_str());
+    std::remove(candidate_event_path.c_str());
+    std::remove(scenario_path.c_str());
+}
@@ -0,0 +1,103 @@
+#include "catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "morton_order.hpp"
+#include "nlohmann/json.hpp"
+#include "scenario_fixture.hpp"
+#include "soa_simulation.hpp"
+
+namespace {
+
+/**
+ * @brief 南北に離れた場所を交互にシナリオへ書き、斥候が行き交うシナリオを書き出します。
+ *
+ * @details シナリオの順番と空間の順番がずれているため、並べ替えると配列の順番が変わります。
+ */
+std::string writeInterleavedScenario() {
+    nlohmann::json team_a_objects = nlohmann::json::array();
+    nlohmann::json team_b_objects = nlohmann::json::array();
+    for (int k = 0; k < 6; ++k) {
+        double lat = (k % 2 == 0) ? 33.0 + 0.01 * k : 33.5 - 0.01 * k;
+        team_a_objects.push_back(makeObject("A_S0" + std::to_string(k), "scout", 15 * k,
+                                            {makePoint(lat, 130.0, 200.0), makePoint(66.5 - lat, 130.0, 200.0)}));
+        team_b_objects.push_back(makeObject("B_S0" + std::to_string(k), "scout", 10 * k,
+                                            {makePoint(66.5 - lat, 130.02, 150.0), makePoint(lat, 130.02, 150.0)}));
+        team_b_objects.push_back(makeObject("B_M0" + std::to_string(k), "messenger", 0,
+                                            {makePoint(lat, 130.05, 100.0), makePoint(lat, 129.95, 100.0)}));
+    }
+    team_a_objects.push_back(makeObject("A_C00", "commander", 0, {makePoint(33.2, 130.0, 0.0)}));
+    team_b_objects.push_back(makeObject("B_A00", "attacker", 0,
+                                        {makePoint(33.5, 130.0, 200.0), makePoint(33.0, 130.0, 200.0)}));
+
+    return writeScenario("soa_morton_order_scenario.json", makePerformance(2000, 4000, 3000),
+                         std::move(team_a_objects), std::move(team_b_objects));
+}
+
+} // namespace
+
+TEST_CASE("Mortonコードが2軸のビットを交互に並べ、負のセル座標も大小関係を保つこと", "[morton_order]") {
+    // 2x2のセルはZの字の順(左下、右下、左上、右上)に並びます。
+    REQUIRE(mortonCode(CellKey{0, 0}) < mortonCode(CellKey{1, 0}));
+    REQUIRE(mortonCode(CellKey{1, 0}) < mortonCode(CellKey{0, 1}));
+    REQUIRE(mortonCode(CellKey{0, 1}) < mortonCode(CellKey{1, 1}));
+    REQUIRE((mortonCode(CellKey{1, 1}) ^ mortonCode(CellKey{0, 0})) == 3u);
+    // 原点をまたいでも、同じ行・同じ列の中では座標の順番のままです。
+    REQUIRE(mortonCode(CellKey{-1, 0}) < mortonCode(CellKey{0, 0}));
+    REQUIRE(mortonCode(CellKey{0, -1}) < mortonCode(CellKey{0, 0}));
+    REQUIRE(mortonCode(CellKey{-2, 5}) < mortonCode(CellKey{-1, 5}));
+}
+
+TEST_CASE("並べ替えを有効にしても、シナリオの順番で見た位置と探知状態が並べ替えなしと毎秒一致すること",
+          "[morton_order]") {
+    std::string scenario_path = writeInterleavedScenario();
+    std::string reference_timeline_path = tempPath("soa_morton_plain_timeline.ndjson");
+    std::string reference_event_path = tempPath("soa_morton_plain_event.ndjson");
+    std::string candidate_timeline_path = tempPath("soa_morton_reorder_timeline.ndjson");
+    std::string candidate_event_path = tempPath("soa_morton_reorder_event.ndjson");
+    SoaSimulation reference;
+    reference.setReorderInterval(0);
+    reference.setSpatialCheck(true);
+    reference.initialize(scenario_path, reference_timeline_path, reference_event_path);
+    SoaSimulation candidate;
+    candidate.setReorderInterval(7);
+    candidate.setSpatialCheck(true);
+    candidate.initialize(scenario_path, candidate_timeline_path, candidate_event_path);
+
+    bool reordered = false;
+    size_t max_detected = 0;
+    for (int time_sec = 0; time_sec <= 20 * 60; ++time_sec) {
+        reference.step(time_sec);
+        candidate.step(time_sec);
+        const SoaStorage &ref_storage = reference.storage();
+        const SoaStorage &cand_storage = candidate.storage();
+        REQUIRE(cand_storage.scenario_order.size() == ref_storage.scenario_order.size());
+        size_t detected = 0;
+        for (size_t k = 0; k < ref_storage.scenario_order.size(); ++k) {
+            size_t ref_index = ref_storage.scenario_order[k];
+            size_t cand_index = cand_storage.scenario_order[k];
+            reordered = reordered || ref_index != cand_index;
+            INFO("time_sec=" << time_sec << " object=" << ref_storage.objectId(ref_index));
+            REQUIRE(cand_storage.object_handles[cand_index] == ref_storage.object_handles[ref_index]);
+            // 位置の計算は添字によらないため、並べ替えても値はビット単位で同じです。
+            REQUIRE(cand_storage.ecef_xs[cand_index] == ref_storage.ecef_xs[ref_index]);
+            REQUIRE(cand_storage.ecef_ys[cand_index] == ref_storage.ecef_ys[ref_index]);
+            REQUIRE(cand_storage.ecef_zs[cand_index] == ref_storage.ecef_zs[ref_index]);
+            REQUIRE(cand_storage.detect_states[cand_index].targets == ref_storage.detect_states[ref_index].targets);
+            REQUIRE(cand_storage.has_detonated[cand_index] == ref_storage.has_detonated[ref_index]);
+            detected += ref_storage.detect_states[ref_index].targets.size();
+        }
+        max_detected = std::max(max_detected, detected);
+    }
+    // 配列の順番が実際に変わり、探知も起きていることを確かめます。
+    REQUIRE(reordered);
+    REQUIRE(max_detected > 0);
+    std::remove(reference_timeline_path.c_str());
+    std::remove(reference_event_path.c_str());
+    std::remove(candidate_timeline_path.c_str());
+    std::remove(candidate_event_path.c_str());
+    std::remove(scenario_path.c_str());
+}
@@ -0,0 +1,174 @@
+#include "catch_amalgamated.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "geo.hpp"
+#include "position_kernel.hpp"
+#include "route.hpp"
+#include "soa_storage.hpp"
+
+namespace {
+
+/**
+ * @brief テスト用に1体分の経路をSoA配列へ追加します。
+ */
+void appendObject(SoaStorage &storage,
+                  jsonobj::Role role,
+                  int start_sec,
+                  const std::vector<RoutePoint> &route) {
+    auto segment_info = buildSegmentTimes(route);
+
+    storage.object_handles.push_back(storage.object_names.intern("obj-" + std::to_string(storage.object_handles.size())));
+    storage.team_indices.push_back(static_cast<uint8_t>(storage.team_names.intern("team-a")));
+    storage.roles.push_back(role);
+    storage.start_secs.push_back(start_sec);
+    storage.ecef_xs.push_back(0.0);
+    storage.ecef_ys.push_back(0.0);
+    storage.ecef_zs.push_back(0.0);
+
+    storage.route_offsets.push_back(storage.route_points.size());
+    storage.route_counts.push_back(route.size());
+    storage.route_points.insert(storage.route_points.end(), route.begin(), route.end());
+
+    storage.segment_offsets.push_back(storage.segment_end_secs.size());
+    storage.segment_counts.push_back(segment_info.first.size());
+    storage.segment_cursors.push_back(0);
+    storage.segment_end_secs.insert(
+        storage.segment_end_secs.end(), segment_info.first.begin(), segment_info.first.end());
+    std::vector<SegmentMotion> motions = buildSegmentMotions(route, segment_info.first);
+    storage.segment_motions.insert(storage.segment_motions.end(), motions.begin(), motions.end());
+    storage.total_duration_secs.push_back(segment_info.second);
+
+    storage.detect_states.emplace_back();
+    storage.has_detonated.push_back(false);
+}
+
+RoutePoint makePoint(double lat_deg, double lon_deg, double speeds_kph) {
+    RoutePoint point;
+    point.lat_deg = lat_deg;
+    point.lon_deg = lon_deg;
+    point.alt_m = 0.0;
+    point.speeds_kph = speeds_kph;
+    point.ecef = geodeticToEcef(lat_deg, lon_deg, 0.0);
+    return point;
+}
+
+/**
+ * @brief 分岐のすべて(司令官・開始前・移動中・区間またぎ・速度0・長さ0の区間・完了後)を含む配列を作ります。
+ */
+SoaStorage buildMixedStorage() {
+    SoaStorage storage;
+    for (int k = 0; k < 37; ++k) {
+        double lat = 35.0 + 0.01 * k;
+        double lon = 135.0 + 0.02 * k;
+        std::vector<RoutePoint> route;
+        jsonobj::Role role = jsonobj::Role::MESSENGER;
+        switch (k % 6) {
+        case 0:
+            role = jsonobj::Role::COMMANDER;
+            route = {makePoint(lat, lon, 0.0)};
+            break;
+        case 1:
+            // 速度0の区間(所要時間が無限大)を含みます。
+            route = {makePoint(lat, lon, 36.0), makePoint(lat + 0.001, lon, 0.0), makePoint(lat, lon + 0.1, 10.0)};
+            break;
+        case 2:
+            // 同じ点が続く長さ0の区間を含みます。
+            route = {makePoint(lat, lon, 72.0), makePoint(lat, lon, 72.0), makePoint(lat + 0.001, lon, 72.0)};
+            break;
+        case 3:
+            // 経路点が1つだけで区間がありません。
+            route = {makePoint(lat, lon, 10.0)};
+            break;
+        default:
+            route = {makePoint(lat, lon, 36.0 + k),
+                     makePoint(lat + 0.002, lon + 0.003, 50.0),
+                     makePoint(lat + 0.004, lon + 0.001, 20.0),
+                     makePoint(lat + 0.005, lon + 0.006, 20.0)};
+            break;
+        }
+        appendObject(storage, role, (k * 3) % 11, route);
+    }
+    // 経路が空のオブジェクトも混ぜます。
+    appendObject(storage, jsonobj::Role::SCOUT, 0, {});
+    return storage;
+}
+
+bool sameBits(double a, double b) {
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+} // namespace
+
+TEST_CASE("SIMD版の位置補間がスカラー版とビット単位で一致すること", "[position_kernel]") {
+    // CPUが対応しているカーネルだけを比較します。未対応のカーネルは検証を省きます。
+    for (PositionKernelIsa isa : {PositionKernelIsa::AVX2, PositionKernelIsa::AVX512}) {
+        if (!isPositionKernelIsaSupported(isa)) {
+            continue;
+        }
+        INFO(positionKernelIsaName(isa));
+        SoaStorage scalar_storage = buildMixedStorage();
+        SoaStorage simd_storage = buildMixedStorage();
+        std::vector<size_t> indices(scalar_storage.object_handles.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            indices[i] = i;
+        }
+
+        // 区間をまたぐ時刻や、時刻の巻き戻しも含めて比較します。
+        std::vector<int> times;
+        for (int t = 0; t <= 200; ++t) {
+            times.push_back(t);
+        }
+        times.push_back(30);
+        times.push_back(5000);
+
+        for (int time_sec : times) {
+            computePositions(PositionKernelIsa::SCALAR, scalar_storage, time_sec, indices.data(), indices.size());
+            computePositions(isa, simd_storage, time_sec, indices.data(), indices.size());
+            for (size_t i = 0; i < indices.size(); ++i) {
+                INFO("time_sec=" << time_sec << " index=" << i);
+                REQUIRE(sameBits(scalar_storage.ecef_xs[i], simd_storage.ecef_xs[i]));
+                REQUIRE(sameBits(scalar_storage.ecef_ys[i], simd_storage.ecef_ys[i]));
+                REQUIRE(sameBits(scalar_storage.ecef_zs[i], simd_storage.ecef_zs[i]));
+            }
+        }
+    }
+}
+
+TEST_CASE("添字で指定したオブジェクトの位置だけが更新されること", "[position_kernel]") {
+    for (PositionKernelIsa isa : {PositionKernelIsa::SCALAR, PositionKernelIsa::AVX2, PositionKernelIsa::AVX512}) {
+        if (!isPositionKernelIsaSupported(isa)) {
+            continue;
+        }
+        INFO(positionKernelIsaName(isa));
+        SoaStorage expected_storage = buildMixedStorage();
+        SoaStorage storage = buildMixedStorage();
+        std::vector<size_t> all_indices(storage.object_handles.size());
+        for (size_t i = 0; i < all_indices.size(); ++i) {
+            all_indices[i] = i;
+        }
+        // 奇数番目だけを飛び飛びに指定します(SIMDの端数処理も通るように9件以上にします)。
+        std::vector<size_t> odd_indices;
+        for (size_t i = 1; i < storage.object_handles.size(); i += 2) {
+            odd_indices.push_back(i);
+        }
+
+        const int time_sec = 40;
+        computePositions(PositionKernelIsa::SCALAR, expected_storage, time_sec, all_indices.data(), all_indices.size());
+        computePositions(isa, storage, time_sec, odd_indices.data(), odd_indices.size());
+        for (size_t i = 0; i < storage.object_handles.size(); ++i) {
+            INFO("index=" << i);
+            if (i % 2 == 1) {
+                REQUIRE(sameBits(expected_storage.ecef_xs[i], storage.ecef_xs[i]));
+                REQUIRE(sameBits(expected_storage.ecef_ys[i], storage.ecef_ys[i]));
+                REQUIRE(sameBits(expected_storage.ecef_zs[i], storage.ecef_zs[i]));
+            } else {
+                // 指定しなかったオブジェクトは初期値の0のまま残ります。
+                REQUIRE(storage.ecef_xs[i] == 0.0);
+                REQUIRE(storage.ecef_ys[i] == 0.0);
+                REQUIRE(storage.ecef_zs[i] == 0.0);
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#include "catch_amalgamated.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "geo.hpp"
+#include "range_kernel.hpp"
+
+namespace {
+
+/**
+ * @brief 北緯33.6度付近の中心の周りに、範囲の内外と境界ちょうどの相手を混ぜて並べます。
+ *
+ * @details SIMDの幅で割り切れない件数にして、端数をスカラーで処理する部分も通るようにします。
+ */
+RangeCandidates makeCandidates(const Ecef &center, double range) {
+    RangeCandidates candidates;
+    for (uint32_t i = 0; i < 53; ++i) {
+        double angle = 0.37 * static_cast<double>(i);
+        // 0.2倍から1.8倍まで少しずつ距離を変えます。7の倍数番目は東へちょうど探知距離だけ離します。
+        double scale = 0.2 + 1.6 * static_cast<double>((i * 29) % 53) / 52.0;
+        if (i % 7 == 0) {
+            candidates.push(i, center.x, center.y + range, center.z);
+            continue;
+        }
+        candidates.push(i, center.x + range * scale * std::cos(angle), center.y + range * scale * std::sin(angle),
+                        center.z + static_cast<double>(i % 5) * 30.0);
+    }
+    return candidates;
+}
+
+} // namespace
+
+TEST_CASE("距離の2乗による判定が、distanceEcefで測った距離の判定と一致すること", "[range_kernel]") {
+    Ecef center = geodeticToEcef(33.6, 130.4, 0.0);
+    double range = 10000.0;
+    RangeCandidates candidates = makeCandidates(center, range);
+
+    filterWithinRange(PositionKernelIsa::SCALAR, center, range * range, candidates);
+    std::vector<uint32_t> expected;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        Ecef other{candidates.xs[i], candidates.ys[i], candidates.zs[i]};
+        if (distanceEcef(center, other) <= range) {
+            expected.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    REQUIRE(candidates.passed == expected);
+    REQUIRE(!expected.empty());
+    REQUIRE(expected.size() < candidates.size());
+    // 範囲内の相手は、距離の2乗の平方根がdistanceEcefとビット単位で同じになります。
+    for (size_t k = 0; k < candidates.passed.size(); ++k) {
+        uint32_t i = candidates.passed[k];
+        double expected_distance = distanceEcef(center, Ecef{candidates.xs[i], candidates.ys[i], candidates.zs[i]});
+        double actual_distance = std::sqrt(candidates.passed_dist_sqs[k]);
+        REQUIRE(std::memcmp(&actual_distance, &expected_distance, sizeof(double)) == 0);
+    }
+}
+
+TEST_CASE("SIMD版の距離判定がスカラー版とビット単位で一致すること", "[range_kernel]") {
+    Ecef center = geodeticToEcef(33.6, 130.4, 0.0);
+    double range = 10000.0;
+    RangeCandidates reference = makeCandidates(center, range);
+    filterWithinRange(PositionKernelIsa::SCALAR, center, range * range, reference);
+
+    for (PositionKernelIsa isa : {PositionKernelIsa::AVX2, PositionKernelIsa::AVX512}) {
+        if (!isPositionKernelIsaSupported(isa)) {
+            continue;
+        }
+        INFO("isa=" << positionKernelIsaName(isa));
+        RangeCandidates candidates = makeCandidates(center, range);
+        size_t passed_count = filterWithinRange(isa, center, range * range, candidates);
+        REQUIRE(passed_count == reference.passed.size());
+        REQUIRE(candidates.passed == reference.passed);
+        REQUIRE(std::memcmp(candidates.passed_dist_sqs.data(), reference.passed_dist_sqs.data(),
+                            passed_count * sizeof(double)) == 0);
+    }
+
+    // 相手がいないときは何も書き込みません。
+    RangeCandidates empty;
+    REQUIRE(filterWithinRange(selectPositionKernelIsa(), center, range * range, empty) == 0);
+    REQUIRE(empty.passed.empty());
+}
@@ -0,0 +1,172 @@
+#include "catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "geo.hpp"
+#include "local_frame.hpp"
+#include "soa_storage.hpp"
+#include "spatial_hash.hpp"
+
+namespace {
+
+/**
+ * @brief ID・チーム・位置だけを持つSoA配列を作ります。空間格子が読むのはこれらの配列だけです。
+ *
+ * @details 3チームに順番に振り分け、2チームより多い場合もチームごとに分かれることを確かめられるようにします。
+ */
+SoaStorage makeStorage(size_t count) {
+    SoaStorage storage;
+    for (const char *team : {"A", "B", "C"}) {
+        storage.team_names.intern(team);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        storage.object_handles.push_back(storage.object_names.intern("obj-" + std::to_string(i)));
+        storage.team_indices.push_back(static_cast<uint8_t>(i % 3));
+        storage.ecef_xs.push_back(static_cast<double>((i * 37) % 23) * 45.0 - 500.0);
+        storage.ecef_ys.push_back(static_cast<double>((i * 11) % 7) * 130.0 - 390.0);
+        storage.ecef_zs.push_back(i % 5 == 0 ? 1.0e6 : -20.0);
+    }
+    return storage;
+}
+
+/**
+ * @brief 各オブジェクトのセルの中身が、総当たりで求めた同じチーム・同じセルのオブジェクトと一致するかを確かめます。
+ *
+ * @details リスト内の並び順は決まっていないので、並べ替えてから比べます。
+ */
+void requireMatchesBruteForce(const SpatialGrid &grid, const SoaStorage &storage, double cell_size) {
+    for (size_t i = 0; i < storage.object_handles.size(); ++i) {
+        CellKey key = objectCellKey(storage, i, cell_size);
+        uint8_t team = storage.team_indices[i];
+        std::vector<int> expected;
+        for (size_t j = 0; j < storage.object_handles.size(); ++j) {
+            if (storage.team_indices[j] == team && objectCellKey(storage, j, cell_size) == key) {
+                expected.push_back(static_cast<int>(j));
+            }
+        }
+        std::vector<int> actual;
+        for (int index : grid.cell(team, key)) {
+            actual.push_back(index);
+        }
+        std::sort(actual.begin(), actual.end());
+        REQUIRE(actual == expected);
+    }
+}
+
+} // namespace
+
+TEST_CASE("空間格子の各セルに、そのチームでそのセルにいるオブジェクトだけが入ること", "[spatial_hash]") {
+    SoaStorage storage = makeStorage(300);
+    SpatialGrid grid;
+    grid.build(storage, 100.0);
+    requireMatchesBruteForce(grid, storage, 100.0);
+    grid.verify(storage);
+
+    // 誰もいないセルは空の範囲になります。
+    SpatialGrid::CellRange empty = grid.cell(0, CellKey{1000000, 1000000});
+    REQUIRE(!(empty.begin() != empty.end()));
+
+    // セルサイズが0以下なら、どのセルも空です。
+    SpatialGrid disabled;
+    disabled.build(storage, 0.0);
+    SpatialGrid::CellRange none = disabled.cell(0, objectCellKey(storage, 0, 100.0));
+    REQUIRE(!(none.begin() != none.end()));
+}
+
+TEST_CASE("updateはセルをまたいだオブジェクトだけを付け替えること", "[spatial_hash]") {
+    SoaStorage storage = makeStorage(300);
+    SpatialGrid grid;
+    grid.build(storage, 100.0);
+
+    std::vector<size_t> moved;
+    for (size_t i = 0; i < storage.object_handles.size(); i += 3) {
+        moved.push_back(i);
+    }
+    // 1秒目はセル内で1mだけ動かすので、誰もセルをまたぎません。
+    for (size_t i : moved) {
+        double x = storage.ecef_xs[i];
+        storage.ecef_xs[i] = std::floor(x / 100.0) * 100.0 + 50.0;
+    }
+    grid.build(storage, 100.0);
+    for (size_t i : moved) {
+        storage.ecef_xs[i] += 1.0;
+    }
+    grid.update(storage, moved.data(), moved.size());
+    REQUIRE(grid.lastCrossingCount() == 0);
+    grid.verify(storage);
+
+    // 2秒目は半分だけ隣のセルへ動かします。
+    size_t expected_crossings = 0;
+    for (size_t k = 0; k < moved.size(); ++k) {
+        if (k % 2 == 0) {
+            storage.ecef_xs[moved[k]] += 100.0;
+            ++expected_crossings;
+        }
+    }
+    grid.update(storage, moved.data(), moved.size());
+    REQUIRE(grid.lastCrossingCount() == expected_crossings);
+    grid.verify(storage);
+    requireMatchesBruteForce(grid, storage, 100.0);
+
+    // 遠くへ何度も動かして空のセルを溜め、掃除が起きても中身が正しいことを確かめます。
+    for (int round = 0; round < 20; ++round) {
+        for (size_t i : moved) {
+            storage.ecef_ys[i] += 1000.0;
+        }
+        grid.update(storage, moved.data(), moved.size());
+        grid.verify(storage);
+    }
+    requireMatchesBruteForce(grid, storage, 100.0);
+}
+
+TEST_CASE("格子に知らせずに位置を変えると検証が失敗すること", "[spatial_hash]") {
+    SoaStorage storage = makeStorage(10);
+    SpatialGrid grid;
+    grid.build(storage, 100.0);
+    storage.ecef_xs[3] += 500.0;
+    REQUIRE_THROWS_AS(grid.verify(storage), std::runtime_error);
+}
+
+TEST_CASE("TeamMaskは立てたチーム番号を昇順にたどること", "[spatial_hash]") {
+    TeamMask mask;
+    for (uint8_t team : {200, 3, 64, 0, 255}) {
+        mask.set(team);
+    }
+    std::vector<int> teams;
+    mask.forEach([&](uint8_t team) { teams.push_back(team); });
+    REQUIRE(teams == std::vector<int>{0, 3, 64, 200, 255});
+    REQUIRE(mask.test(64));
+    REQUIRE_FALSE(mask.test(65));
+}
+
+TEST_CASE("距離がセルサイズ以内の2点は、高度が違っても接平面上で隣り合うセルに入ること", "[spatial_hash]") {
+    // 3x3セルの探索で取りこぼしがないことを、原点から離れた位置や高度差のある組で確かめます。
+    LocalFrame frame = makeLocalFrame(33.9, 130.0);
+    const double cell_size = 10000.0;
+    std::vector<Ecef> points;
+    for (int i = 0; i < 40; ++i) {
+        double lat = 33.9 + 1.2 * static_cast<double>((i * 7) % 11 - 5) / 5.0;
+        double lon = 130.0 + 1.4 * static_cast<double>((i * 5) % 13 - 6) / 6.0;
+        points.push_back(geodeticToEcef(lat, lon, static_cast<double>(i % 4) * 2500.0));
+        // 近くに、高度と位置を少しずらした点も置きます。
+        points.push_back(geodeticToEcef(lat + 0.03, lon - 0.04, static_cast<double>(i % 3) * 3000.0));
+    }
+    size_t close_pairs = 0;
+    for (size_t a = 0; a < points.size(); ++a) {
+        for (size_t b = a + 1; b < points.size(); ++b) {
+            if (distanceEcef(points[a], points[b]) > cell_size) {
+                continue;
+            }
+            ++close_pairs;
+            CellKey ka = cellKey(frame, points[a], cell_size);
+            CellKey kb = cellKey(frame, points[b], cell_size);
+            REQUIRE(std::abs(ka.x - kb.x) <= 1);
+            REQUIRE(std::abs(ka.y - kb.y) <= 1);
+        }
+    }
+    REQUIRE(close_pairs > 0);
+}
@@ -0,0 +1,146 @@
+#include "catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "geo.hpp"
+#include "local_frame.hpp"
+#include "nlohmann/json.hpp"
+#include "scenario_fixture.hpp"
+#include "soa_simulation.hpp"
+#include "soa_storage.hpp"
+#include "sweep_and_prune.hpp"
+
+namespace {
+
+/**
+ * @brief 東西に散らばり、南北には7段に並ぶcount体分の位置を持つSoA配列を作ります。
+ */
+SoaStorage makeColumnStorage(size_t count) {
+    std::vector<Ecef> positions;
+    for (size_t i = 0; i < count; ++i) {
+        positions.push_back(
+            Ecef{static_cast<double>((i * 37) % 101) * 20.0, static_cast<double>((i * 11) % 7) * 130.0, 0.0});
+    }
+    return makeStorage(positions);
+}
+
+/**
+ * @brief forEachNearで受け取る相手が、総当たりで求めた「軸上の差がrange以内の相手」と一致するかを確かめます。
+ */
+void requireMatchesBruteForce(const SweepAndPrune &sweep, const SoaStorage &storage, double range) {
+    for (size_t i = 0; i < storage.object_handles.size(); ++i) {
+        std::vector<size_t> expected;
+        for (size_t j = 0; j < storage.object_handles.size(); ++j) {
+            if (j != i && std::abs(storage.ecef_xs[j] - storage.ecef_xs[i]) <= range) {
+                expected.push_back(j);
+            }
+        }
+        std::vector<size_t> actual;
+        sweep.forEachNear(i, range, [&](size_t other) { actual.push_back(other); });
+        std::sort(actual.begin(), actual.end());
+        REQUIRE(actual == expected);
+    }
+}
+
+/**
+ * @brief 2チームの船団が同じ航路を逆向きにすれ違うシナリオを書き出します。
+ *
+ * @details 船団は数秒おきに出発する縦列なので、オブジェクトが航路沿いの少数のセルに固まります。
+ */
+std::string writeConvoyScenario() {
+    nlohmann::json team_a_objects = nlohmann::json::array();
+    nlohmann::json team_b_objects = nlohmann::json::array();
+    for (int k = 0; k < 12; ++k) {
+        std::string suffix = (k < 10 ? "0" : "") + std::to_string(k);
+        team_a_objects.push_back(makeObject("A_S" + suffix, k % 3 == 0 ? "scout" : "messenger", 20 * k,
+                                            {makePoint(33.0, 130.0, 180.0), makePoint(33.4, 130.01, 180.0)}));
+        team_b_objects.push_back(makeObject("B_S" + suffix, k % 2 == 0 ? "scout" : "messenger", 15 * k,
+                                            {makePoint(33.4, 130.012, 160.0), makePoint(33.0, 130.002, 160.0)}));
+    }
+
+    return writeScenario("soa_sweep_and_prune_scenario.json", makePerformance(2000, 3000, 3000),
+                         std::move(team_a_objects), std::move(team_b_objects));
+}
+
+} // namespace
+
+TEST_CASE("スイープの並びから、軸上の差が範囲内の相手だけを受け取れること", "[sweep_and_prune]") {
+    SoaStorage storage = makeColumnStorage(200);
+    SweepAndPrune sweep;
+    sweep.build(storage, SweepAxis::EAST);
+    sweep.verify(storage);
+    requireMatchesBruteForce(sweep, storage, 150.0);
+    requireMatchesBruteForce(sweep, storage, 0.0);
+}
+
+TEST_CASE("updateは動いたオブジェクトの座標を書き換え、挿入ソートで並びを直すこと", "[sweep_and_prune]") {
+    SoaStorage storage = makeColumnStorage(200);
+    SweepAndPrune sweep;
+    sweep.build(storage, SweepAxis::EAST);
+
+    // 少しだけ動かしたオブジェクトは並びの近くに留まり、大きく動かしたものは遠くまで入れ替わります。
+    std::vector<size_t> moved{3, 50, 51, 120};
+    storage.ecef_xs[3] += 5.0;
+    storage.ecef_xs[50] -= 1500.0;
+    storage.ecef_xs[51] += 700.0;
+    storage.ecef_xs[120] += 0.5;
+    sweep.update(storage, moved.data(), moved.size());
+    sweep.verify(storage);
+    REQUIRE(sweep.lastSwapCount() > 0);
+    requireMatchesBruteForce(sweep, storage, 150.0);
+
+    // 動いていなければ入れ替えは起きません。
+    sweep.update(storage, moved.data(), moved.size());
+    REQUIRE(sweep.lastSwapCount() == 0);
+
+    // updateに渡さずに動かすと、検証で食い違いが見つかります。
+    storage.ecef_xs[7] += 3000.0;
+    REQUIRE_THROWS_AS(sweep.verify(storage), std::runtime_error);
+}
+
+TEST_CASE("経路点が広く散らばっているほうの軸が選ばれること", "[sweep_and_prune]") {
+    LocalFrame frame = makeLocalFrame(33.0, 130.0);
+    std::vector<RoutePoint> north_south;
+    std::vector<RoutePoint> east_west;
+    for (int k = 0; k < 5; ++k) {
+        RoutePoint point{};
+        point.ecef = geodeticToEcef(33.0 + 0.1 * k, 130.0 + 0.01 * k, 0.0);
+        north_south.push_back(point);
+        point.ecef = geodeticToEcef(33.0 + 0.01 * k, 130.0 + 0.1 * k, 0.0);
+        east_west.push_back(point);
+    }
+    REQUIRE(selectDominantAxis(frame, north_south) == SweepAxis::NORTH);
+    REQUIRE(selectDominantAxis(frame, east_west) == SweepAxis::EAST);
+}
+
+TEST_CASE("SWEEP_AND_PRUNE方式の探知状態が、船団のシナリオで毎秒GRID方式と一致すること", "[sweep_and_prune]") {
+    std::string scenario_path = writeConvoyScenario();
+    std::string reference_timeline_path = tempPath("soa_sweep_grid_timeline.ndjson");
+    std::string reference_event_path = tempPath("soa_sweep_grid_event.ndjson");
+    std::string candidate_timeline_path = tempPath("soa_sweep_sap_timeline.ndjson");
+    std::string candidate_event_path = tempPath("soa_sweep_sap_event.ndjson");
+    SoaSimulation reference;
+    reference.setBroadphase(Broadphase::GRID);
+    reference.setReorderInterval(0);
+    reference.setSpatialCheck(true);
+    reference.initialize(scenario_path, reference_timeline_path, reference_event_path);
+    // 並べ替えを組み合わせても、スイープの並びが作り直されることを同時に確かめます。
+    SoaSimulation candidate;
+    candidate.setBroadphase(Broadphase::SWEEP_AND_PRUNE);
+    candidate.setReorderInterval(13);
+    candidate.setSpatialCheck(true);
+    candidate.initialize(scenario_path, candidate_timeline_path, candidate_event_path);
+
+    size_t max_detected = requireSameDetections(reference, candidate, 20 * 60);
+    REQUIRE(max_detected > 0);
+    std::remove(reference_timeline_path.c_str());
+    std::remove(reference_event_path.c_str());
+    std::remove(candidate_timeline_path.c_str());
+    std::remove(candidate_event_path.c_str());
+    std::remove(scenario_path.c_str());
+}
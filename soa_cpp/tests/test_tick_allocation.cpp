@@ -0,0 +1,170 @@
+#include "catch_amalgamated.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "allocation_counter.hpp"
+#include "geo.hpp"
+#include "logging.hpp"
+#include "nlohmann/json.hpp"
+#include "scenario_fixture.hpp"
+#include "soa_simulation.hpp"
+
+namespace {
+
+/**
+ * @brief 指定した秒数だけstepを進め、その間のヒープ確保回数を返します。
+ */
+size_t countAllocations(SoaSimulation &simulation, int first_sec, int last_sec) {
+    beginAllocationCount();
+    for (int time_sec = first_sec; time_sec <= last_sec; ++time_sec) {
+        simulation.step(time_sec);
+    }
+    return endAllocationCount();
+}
+
+/**
+ * @brief 2チームの斥候・伝令・攻撃役が互いの探知範囲内をゆっくり進むシナリオを書き出します。
+ *
+ * @details 探知状態の表が毎秒空にならないようにし、表の作り直しでもヒープ確保が起きないことを確かめます。
+ *          IDは短い文字列の最適化(SSO)に収まらない長さにして、文字列の確保も検証対象に含めます。
+ */
+std::string writeSteadyScenario() {
+    nlohmann::json team_a_objects = nlohmann::json::array();
+    nlohmann::json team_b_objects = nlohmann::json::array();
+    team_a_objects.push_back(makeObject("alpha-commander-object", "commander", 0, {makePoint(33.0, 130.0, 0.0)}));
+    team_b_objects.push_back(makeObject("bravo-commander-object", "commander", 0, {makePoint(33.5, 130.5, 0.0)}));
+    for (int k = 0; k < 4; ++k) {
+        double offset = 0.001 * k;
+        team_a_objects.push_back(makeObject("alpha-scout-object-" + std::to_string(k), "scout", k,
+                                            {makePoint(33.2 + offset, 130.2, 10.0), makePoint(33.3 + offset, 130.2, 10.0)}));
+        team_b_objects.push_back(makeObject("bravo-scout-object-" + std::to_string(k), "scout", k,
+                                            {makePoint(33.2 + offset, 130.21, 10.0), makePoint(33.3 + offset, 130.21, 10.0)}));
+        team_b_objects.push_back(makeObject("bravo-messenger-object-" + std::to_string(k), "messenger", 0,
+                                            {makePoint(33.2 - offset, 130.22, 12.0), makePoint(33.3 - offset, 130.22, 12.0)}));
+    }
+    team_a_objects.push_back(makeObject("alpha-attacker-object", "attacker", 0,
+                                        {makePoint(33.2, 130.19, 5.0), makePoint(33.3, 130.19, 5.0)}));
+    // 数える区間(60〜659秒)の途中で動き出す伝令です。移動中リストへの追加でも確保が起きないことを確かめます。
+    team_a_objects.push_back(makeObject("alpha-late-messenger-object", "messenger", 300,
+                                        {makePoint(33.21, 130.18, 12.0), makePoint(33.31, 130.18, 12.0)}));
+
+    return writeScenario("soa_tick_allocation_scenario.json", makePerformance(5000, 10000, 8000),
+                         std::move(team_a_objects), std::move(team_b_objects));
+}
+
+} // namespace
+
+TEST_CASE("定常状態のstepでヒープ確保が起きないこと", "[tick_allocation]") {
+    std::string scenario_path = writeSteadyScenario();
+    std::string timeline_path = tempPath("soa_tick_allocation_timeline.ndjson");
+    std::string event_path = tempPath("soa_tick_allocation_event.ndjson");
+    for (Broadphase broadphase : {Broadphase::GRID, Broadphase::SWEEP_AND_PRUNE, Broadphase::DYNAMIC_BVH}) {
+        for (bool keep_previous : {false, true}) {
+            for (DetectionBackend backend : {DetectionBackend::SORTED_VECTOR, DetectionBackend::BITMATRIX}) {
+                INFO("broadphase=" << broadphaseName(broadphase) << " keep_previous_positions=" << keep_previous
+                                  << " detection_backend=" << detectionBackendName(backend));
+                SoaSimulation simulation;
+                simulation.setKeepPreviousPositions(keep_previous);
+                simulation.setDetectionBackend(backend);
+                simulation.setBroadphase(broadphase);
+                // 並べ替えはその秒だけ作業用の配列を確保するため、ここでは止めておきます。
+                simulation.setReorderInterval(0);
+                simulation.initialize(scenario_path, timeline_path, event_path);
+
+                // 最初の数十秒は全員の移動開始と最初の探知イベントが起き、作業用の配列も育つので数えません。
+                countAllocations(simulation, 0, 59);
+                // 以降は全員が移動中(300秒に動き出す伝令を除く)で、探知している相手も変わらない定常状態です。
+                size_t allocations = countAllocations(simulation, 60, 659);
+                REQUIRE(allocations == 0);
+
+                if (keep_previous) {
+                    // 二重バッファには1秒前の位置が残っていることを確認します。
+                    SoaStorage before = simulation.storage();
+                    simulation.step(660);
+                    const SoaStorage &after = simulation.storage();
+                    REQUIRE(after.prev_ecef_xs == before.ecef_xs);
+                    REQUIRE(after.prev_ecef_ys == before.ecef_ys);
+                    REQUIRE(after.prev_ecef_zs == before.ecef_zs);
+                    REQUIRE(after.ecef_xs != before.ecef_xs);
+                }
+            }
+        }
+    }
+    std::remove(timeline_path.c_str());
+    std::remove(event_path.c_str());
+    std::remove(scenario_path.c_str());
+}
+
+TEST_CASE("タイムラインの書き出しでヒープ確保が起きず、nlohmann::jsonのdump()と同じ行になること", "[tick_allocation]") {
+    std::string scenario_path = writeSteadyScenario();
+    std::string timeline_path = tempPath("soa_tick_allocation_direct_timeline.ndjson");
+    std::string simulation_timeline_path = tempPath("soa_tick_allocation_timeline.ndjson");
+    std::string event_path = tempPath("soa_tick_allocation_event.ndjson");
+    // 最後の秒に、シナリオの順番ごとのIDと緯度を控えておきます。
+    std::vector<std::string> last_ids;
+    std::vector<double> last_lats;
+    {
+        SoaSimulation simulation;
+        // 配列を並べ替えても、prepareで作ったIDなどの部分と位置の対応が崩れないことも確かめます。
+        // 並べ替えの秒の作業用の確保はstep側で起き、ここで数えるのはwriteの中だけです。
+        simulation.setReorderInterval(10);
+        simulation.initialize(scenario_path, simulation_timeline_path, event_path);
+        TimelineLogger logger;
+        logger.open(timeline_path);
+        logger.prepare(simulation.storage(), simulation);
+
+        // 最初の秒でバッファと作業用の配列が育つので、その分は数えません。
+        simulation.step(0);
+        logger.write(0, simulation.storage(), simulation);
+        for (int time_sec = 1; time_sec <= 120; ++time_sec) {
+            simulation.step(time_sec);
+            beginAllocationCount();
+            logger.write(time_sec, simulation.storage(), simulation);
+            REQUIRE(endAllocationCount() == 0);
+        }
+        const SoaStorage &storage = simulation.storage();
+        for (uint32_t i : storage.scenario_order) {
+            double lat = 0.0;
+            double lon = 0.0;
+            double alt = 0.0;
+            ecefToGeodetic(Ecef{storage.ecef_xs[i], storage.ecef_ys[i], storage.ecef_zs[i]}, lat, lon, alt);
+            last_ids.push_back(storage.objectId(i));
+            last_lats.push_back(lat);
+        }
+    }
+
+    // 書き出した行は、読み込み直してdump()した文字列とバイト単位で一致します(キーの順と数値の書式が同じ)。
+    std::ifstream in(timeline_path);
+    std::string line;
+    int expected_sec = 0;
+    while (std::getline(in, line)) {
+        nlohmann::json timeline = nlohmann::json::parse(line);
+        REQUIRE(timeline.dump() == line);
+        REQUIRE(timeline.at("time_sec").get<int>() == expected_sec);
+        REQUIRE(timeline.at("positions").size() == 16);
+        for (const auto &position : timeline.at("positions")) {
+            REQUIRE(position.size() == 6);
+            REQUIRE(position.at("object_id").is_string());
+            REQUIRE(position.at("team_id").is_string());
+            REQUIRE(position.at("role").is_string());
+            REQUIRE(position.at("lat_deg").is_number());
+            REQUIRE(position.at("lon_deg").is_number());
+            REQUIRE(position.at("alt_m").is_number());
+        }
+        if (expected_sec == 120) {
+            for (size_t k = 0; k < last_ids.size(); ++k) {
+                REQUIRE(timeline.at("positions")[k].at("object_id").get<std::string>() == last_ids[k]);
+                REQUIRE(timeline.at("positions")[k].at("lat_deg").get<double>() == last_lats[k]);
+            }
+        }
+        ++expected_sec;
+    }
+    REQUIRE(expected_sec == 121);
+    std::remove(timeline_path.c_str());
+    std::remove(simulation_timeline_path.c_str());
+    std::remove(event_path.c_str());
+    std::remove(scenario_path.c_str());
+}